@@ -0,0 +1,90 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/utils.h>
+
+namespace Sune
+{
+    //What resident sample memory is counted against in the allocator stats, one per preset assets were built with.
+    using SampleGroupId = AZ::u32;
+    constexpr SampleGroupId DefaultSampleGroup = 0;
+
+    //Any thread, memory for resident samples from the SampleAllocator. Always aligned to SampleMemoryAlignment.
+    constexpr size_t SampleMemoryAlignment = 64;
+    void* AllocateSampleMemory(size_t bytes, SampleGroupId group);
+    void FreeSampleMemory(void* data, size_t bytes, SampleGroupId group);
+
+    //Owns a block of resident samples from the SampleAllocator.
+    //Unlike a vector it never grows, Allocate replaces whatever it held and leaves the new samples uninitialised.
+    template<typename T>
+    class SampleBuffer
+    {
+    public:
+        SampleBuffer() = default;
+        ~SampleBuffer()
+        {
+            Reset();
+        }
+
+        SampleBuffer(const SampleBuffer&) = delete;
+        SampleBuffer& operator=(const SampleBuffer&) = delete;
+
+        SampleBuffer(SampleBuffer&& other)
+            : m_data(AZStd::exchange(other.m_data, nullptr))
+            , m_size(AZStd::exchange(other.m_size, 0))
+            , m_group(other.m_group)
+        {
+        }
+
+        SampleBuffer& operator=(SampleBuffer&& other)
+        {
+            if (this != &other)
+            {
+                Reset();
+                m_data = AZStd::exchange(other.m_data, nullptr);
+                m_size = AZStd::exchange(other.m_size, 0);
+                m_group = other.m_group;
+            }
+            return *this;
+        }
+
+        void Allocate(size_t count, SampleGroupId group)
+        {
+            Reset();
+            if (count == 0)
+            {
+                return;
+            }
+
+            m_data = static_cast<T*>(AllocateSampleMemory(count * sizeof(T), group));
+            m_size = m_data != nullptr ? count : 0;
+            m_group = group;
+        }
+
+        void Reset()
+        {
+            if (m_data != nullptr)
+            {
+                FreeSampleMemory(m_data, m_size * sizeof(T), m_group);
+            }
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        T* data() { return m_data; }
+        const T* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+    private:
+        T* m_data = nullptr;
+        size_t m_size = 0;
+        SampleGroupId m_group = DefaultSampleGroup;
+    };
+}
@@ -6,10 +6,14 @@
  */
 #pragma once
 #include "SuneTypeIds.h"
+#include "SampleBuffer.h"
 
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
 
 namespace lab
 {
@@ -23,6 +27,8 @@ namespace Sune
         Uncompressed,
         OriginalFile,
         Vorbis,
+        Opus, //Cheaper to decode than Vorbis, meant for voice and dialogue
+        Adpcm, //Stays 4 bit in memory and is decoded a block at a time as it plays
     };
 
     enum class AudioLoadMethod
@@ -31,6 +37,32 @@ namespace Sune
         DecodeOnDemand //Decodded and straemed from disc on playback
     };
 
+    //How decoded samples are kept in memory.
+    enum class SamplePrecision
+    {
+        Float32,
+        Int16,
+        Half, //IEEE 754 binary16
+    };
+
+    inline size_t GetSampleSize(SamplePrecision precision)
+    {
+        return precision == SamplePrecision::Float32 ? sizeof(float) : sizeof(AZ::u16);
+    }
+
+    //A page in the compressed payload that decoding can restart from.
+    //Decoding from m_byteOffset and dropping everything before m_frame gives sample exact output.
+    struct SoundSegment
+    {
+        AZ_TYPE_INFO(SoundSegment, SuneSoundSegmentTypeId);
+
+        AZ::u64 m_byteOffset = 0; //From the start of the payload
+        AZ::u64 m_frame = 0;
+    };
+
+    //The last point at or before frame in a table sorted by frame, null if decoding has to start from the beginning.
+    const SoundSegment* FindSeekPoint(const AZStd::vector<SoundSegment>& seekTable, AZ::u64 frame);
+
     class SoundAsset
         : public AZ::Data::AssetData
     {
@@ -41,26 +73,73 @@ namespace Sune
         static constexpr const char* FileExtension = "ssa";
         static constexpr const char* AssetGroup = "Sound";
         static constexpr AZ::u32 AssetSubId = 0;
+        //Uncompressed PCM starts on a page boundary so it can be mapped straight from the file.
+        static constexpr AZ::u64 UncompressedAlignment = 4096;
+        //The BS.1770 absolute gate, anything at or below it measured as silent.
+        static constexpr float SilentLoudness = -70.0f;
 
         static void Reflect(AZ::ReflectContext* context);
 
         SoundAsset();
+        //Members of a sound bank, created ready by the bank rather than by the asset manager.
+        SoundAsset(const AZ::Data::AssetId& assetId, AssetStatus status);
         ~SoundAsset() override = default;
 
         AudioImportFormat m_importFormat = AudioImportFormat::Vorbis;
         AudioLoadMethod m_loadMethod = AudioLoadMethod::DecodeOnDemand;
+        SamplePrecision m_precision = SamplePrecision::Float32;
 
         int m_channels = 0;
         int m_sampleRate = 0;
         size_t m_totalSamples = 0;
 
+        //Segment starts after the first, lets long assets be decoded in parallel.
+        AZStd::vector<SoundSegment> m_segments;
+        //Every audio page, so decoding can start anywhere after at most one page.
+        AZStd::vector<SoundSegment> m_seekTable;
+
+        //Hash of the payload that follows the header, null for products built before it was added.
+        AZ::Uuid m_payloadHash = AZ::Uuid::CreateNull();
+
+        //Integrated loudness in LUFS and true peak in dBTP of the built samples, before m_volume.
+        //Silent sounds and products built before they were measured have SilentLoudness and aren't normalised.
+        float m_loudness = SilentLoudness;
+        float m_truePeak = 0.0f;
+        //Linear gain from the asset's settings, applied on playback rather than baked into the samples.
+        float m_volume = 1.0f;
+        //The preset it was built with, resident samples are counted against it in the SampleAllocator stats.
+        AZStd::string m_presetName;
+
         //Gets set once loaded
         std::shared_ptr<lab::AudioBus> m_bus = {};
 
         //Decode on load
-        AZStd::vector<float> m_samples;
+        SampleBuffer<float> m_samples;
+        //Int16 and Half samples, played through a CompactSoundSource instead of the bus.
+        SampleBuffer<AZ::u16> m_compactSamples;
+        //Set from m_presetName when the samples are loaded.
+        SampleGroupId m_sampleGroup = DefaultSampleGroup;
+        //Planar samples in m_precision, wherever they ended up. ADPCM blocks for Adpcm assets.
+        void* m_sampleData = nullptr;
+        //Keeps the bus memory alive when it isn't m_samples, like a mapping of an uncompressed asset.
+        AZStd::shared_ptr<void> m_sampleOwner;
+        //Frames from the start of m_sampleData that can be played, the rest may still be decoding in the background.
+        AZStd::atomic<AZ::u64> m_decodedFrames = 0;
+
+        //Where the payload lives in the product, so it can be streamed or loaded again after being evicted.
+        AZStd::string m_streamPath;
+        AZ::u64 m_payloadOffset = 0;
+        AZ::u64 m_payloadSize = 0;
+        //Rate and length in the product, m_sampleRate and m_totalSamples change when resident samples are resampled on load.
+        int m_productSampleRate = 0;
+        size_t m_productTotalSamples = 0;
 
         virtual bool GetLengthInSeconds(float& lengthInSeconds) const;
+        bool IsFullyDecoded() const;
+        //Gain that brings the asset to targetLoudness without its true peak going over maxTruePeak, times m_volume.
+        float GetNormalizedGain(float targetLoudness, float maxTruePeak) const;
+        //Bytes m_sampleData points at, 0 when nothing is resident.
+        AZ::u64 GetResidentSize() const;
     };
 
     using SoundDataAsset = AZ::Data::Asset<SoundAsset>;
@@ -69,4 +148,5 @@ namespace Sune
 
     AZ_TYPE_INFO_SPECIALIZE(Sune::AudioImportFormat, "{FA81243F-BD00-4C69-A77B-2C844DBB7F7F}");
     AZ_TYPE_INFO_SPECIALIZE(Sune::AudioLoadMethod, "{9CF5D1DF-53F6-4E48-8E34-BC0CE2001759}");
+    AZ_TYPE_INFO_SPECIALIZE(Sune::SamplePrecision, "{7A2E5C91-3B6D-4F08-A1C4-E96D28B5F037}");
 }
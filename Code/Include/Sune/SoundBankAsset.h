@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+#include "SuneTypeIds.h"
+#include "SoundAsset.h"
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Sune
+{
+    //Where one sound lives in the bank, m_offset is from the start of the member data.
+    struct SoundBankEntry
+    {
+        AZ_TYPE_INFO(SoundBankEntry, SuneSoundBankEntryTypeId);
+
+        AZ::Data::AssetId m_assetId; //Same id as the sound's own product
+        AZ::u64 m_offset = 0;
+        AZ::u64 m_size = 0;
+    };
+
+    //Many small sounds packed into one product so they load from one file in one pass.
+    //Each member is laid out exactly like a SoundAsset product and can be played by its own asset id once the bank is loaded.
+    //Members are created by the bank and aren't registered with the AssetManager, so GetAsset on a member's id still loads its own product.
+    //Players look in loaded banks first and a bank shares any member already loaded on its own, but a sound loaded on its own
+    //through GetAsset while its bank is loaded is a second SoundAsset with the same id and its own samples.
+    class SoundBankAsset
+        : public AZ::Data::AssetData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SoundBankAsset, AZ::SystemAllocator, 0);
+        AZ_RTTI(SoundBankAsset, SuneSoundBankAssetTypeId, AZ::Data::AssetData);
+
+        static constexpr const char* FileExtension = "ssb";
+        static constexpr const char* SourceExtension = "soundbank";
+        static constexpr AZ::u32 AssetSubId = 0;
+        //Members start on a page boundary so uncompressed ones can still be mapped from the bank.
+        static constexpr AZ::u64 MemberAlignment = SoundAsset::UncompressedAlignment;
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        SoundBankAsset() = default;
+        ~SoundBankAsset() override = default;
+
+        AZStd::vector<SoundBankEntry> m_entries;
+
+        //Gets set once loaded, the SoundAsset a player already had if the sound was loaded on its own first.
+        AZStd::unordered_map<AZ::Data::AssetId, SoundDataAsset> m_members;
+
+        SoundDataAsset FindMember(const AZ::Data::AssetId& assetId) const;
+    };
+
+    using SoundBankDataAsset = AZ::Data::Asset<SoundBankAsset>;
+}
@@ -37,6 +37,16 @@ namespace Sune
     AZ_SUNE_ID(SoundPlayerId, "{8F3A2E1D-4B6C-4A9F-8E2D-1C5B7A9E4F3D}");
     AZ_SUNE_ID(PlayerEffectId, "{2A7E9F4B-3D1C-4E8A-9B5F-6D2A8C4E1B7F}");
 
+    //Order sound loads are started in when more are waiting than /Audio/MaxConcurrentLoads allows.
+    enum class SoundLoadPriority : AZ::u8
+    {
+        Critical, //UI and anything about to play, starts straight away whatever else is loading.
+        Nearby,   //Gameplay sounds close to the listener.
+        Ambience,
+        Prefetch, //Music and anything else that won't play for a while.
+    };
+    AZ_TYPE_INFO_SPECIALIZE(Sune::SoundLoadPriority, "{C4A7E2B9-5D31-4F86-9E0B-7A2D6F18C53E}");
+
     // Player effect factory bus
     class PlayerEffectFactoryRequests
     {
@@ -65,6 +75,17 @@ namespace Sune
         return effect;
     }
 
+    struct SoundMemoryStats
+    {
+        AZ::u64 m_residentBytes = 0;
+        AZ::u64 m_budgetBytes = 0; //0 when there is no budget
+        AZ::u32 m_residentAssets = 0;
+        AZ::u64 m_evictions = 0;
+        AZ::u64 m_reloads = 0; //Evicted assets decoded again because a player needed them
+        AZ::u64 m_pendingReleaseBytes = 0; //Released but waiting for the render thread to stop using it
+        AZ::u64 m_sharedBytes = 0; //Not allocated because an asset with the same content already had it resident
+    };
+
     class SuneRequests
     {
     public:
@@ -87,6 +108,27 @@ namespace Sune
         {
             return nullptr;
         }
+
+        //Sound banks, their members play by their own asset id while the bank is loaded.
+        virtual void LoadSoundBank(const AZ::Data::AssetId& bankId) {}
+        virtual void UnloadSoundBank(const AZ::Data::AssetId& bankId) {}
+        //Null if no ready bank contains the sound.
+        virtual SoundDataAsset FindSoundBankMember(const AZ::Data::AssetId& assetId) const
+        {
+            return {};
+        }
+
+        //Gain players apply to the asset on top of their own, its volume adjustment and loudness normalisation.
+        virtual float GetAssetGain(const SoundAsset& asset) const
+        {
+            return asset.m_volume;
+        }
+
+        //Decoded sample memory of DecodeOnLoad assets against the platform budget.
+        virtual SoundMemoryStats GetSoundMemoryStats() const
+        {
+            return {};
+        }
     };
 
     class SuneBusTraits
@@ -114,6 +156,9 @@ namespace Sune
         virtual void SetAsset(const AZ::Data::AssetId assetId) = 0;
         virtual AZ::Data::AssetId GetAsset() = 0;
 
+        //Used by the next SetAsset, and by the current asset if it's still waiting to load.
+        virtual void SetLoadPriority(SoundLoadPriority priority) = 0;
+
         virtual void SetPlayMultiple(bool canPlayMultiple) = 0;
         //GetPlayMultiple?
 
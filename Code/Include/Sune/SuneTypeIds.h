@@ -27,5 +27,11 @@ namespace Sune
 
 
     inline constexpr const char* SuneSoundAssetTypeId = "{6CF7EA90-9FBF-4DB6-8199-A14C978E5EF3}";
+    inline constexpr const char* SuneSoundSegmentTypeId = "{B3D1E6F2-84A7-4C59-9E0B-57F2C1A9D463}";
     inline constexpr const char* SuneSoundAssetBuilderTypeId = "{ED3C6411-6871-4374-BCA5-9D04C33A9FC8}";
+    inline constexpr const char* SuneWaveformPeaksTypeId = "{2A6E9D47-B13C-4F08-9D75-C4E1A83F62B9}";
+
+    inline constexpr const char* SuneSoundBankAssetTypeId = "{3B8F1C62-D4A9-4E07-8C51-A26E9F0B7D34}";
+    inline constexpr const char* SuneSoundBankEntryTypeId = "{91D4E2A7-6C3B-4F85-B0A9-5E17C8F2D6B3}";
+    inline constexpr const char* SuneSoundBankBuilderTypeId = "{C7A53E19-82F4-4B6D-9E0C-14B8D7F3A25E}";
 } // namespace Sune
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+#include "SuneTypeIds.h"
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Sune
+{
+    class MappedFile;
+
+    //One channel over one bin, scaled by WaveformPeaks::BinScale.
+    struct WaveformBin
+    {
+        AZ::s16 m_min = 0;
+        AZ::s16 m_max = 0;
+        AZ::u16 m_rms = 0;
+    };
+
+    struct WaveformLevel
+    {
+        AZ::u32 m_framesPerBin = 0;
+        AZ::u32 m_binCount = 0; //The last bin covers whatever is left
+        AZ::u64 m_offset = 0; //Of the level's bins from the start of the file
+    };
+
+    struct WaveformHeader
+    {
+        static constexpr AZ::u32 Magic = 0x56575353; //"SSWV"
+        static constexpr AZ::u32 Version = 1;
+
+        AZ::u32 m_magic = Magic;
+        AZ::u32 m_version = Version;
+        AZ::u32 m_channels = 0;
+        AZ::u32 m_sampleRate = 0;
+        AZ::u64 m_frames = 0;
+        AZ::u32 m_levelCount = 0;
+        AZ::u32 m_reserved = 0;
+    };
+
+    //Min, max and RMS peaks for drawing a sound without loading its audio, built alongside every sound product.
+    //The file is the header, a level table and then each level's bins, channels of a bin next to each other.
+    //It's written in native byte order so it can be mapped and read in place.
+    class WaveformPeaks
+    {
+    public:
+        AZ_TYPE_INFO(WaveformPeaks, SuneWaveformPeaksTypeId);
+        AZ_CLASS_ALLOCATOR(WaveformPeaks, AZ::SystemAllocator);
+
+        static constexpr const char* FileExtension = "ssw";
+        static constexpr AZ::u32 AssetSubId = 1;
+        //Levels go from the finest to the coarsest, each LevelScale times coarser than the one before.
+        static constexpr AZ::u32 FinestFramesPerBin = 64;
+        static constexpr AZ::u32 CoarsestFramesPerBin = 65536;
+        static constexpr AZ::u32 LevelScale = 4;
+        static constexpr float BinScale = 32767.0f;
+
+        //Maps the file at path, or reads it if it can't be mapped. Null if it isn't a peaks file.
+        static AZStd::unique_ptr<WaveformPeaks> Open(const char* path);
+        //Finds the peaks product that was built with the sound through the asset catalog.
+        static AZStd::unique_ptr<WaveformPeaks> OpenForSound(const AZ::Data::AssetId& soundAssetId);
+
+        ~WaveformPeaks();
+
+        WaveformPeaks(const WaveformPeaks&) = delete;
+        WaveformPeaks& operator=(const WaveformPeaks&) = delete;
+
+        const WaveformHeader& GetHeader() const { return *m_header; }
+        AZ::u32 GetLevelCount() const { return m_header->m_levelCount; }
+        const WaveformLevel& GetLevel(AZ::u32 level) const { return m_levels[level]; }
+        //Bin b of channel c is at b * channels + c.
+        const WaveformBin* GetBins(AZ::u32 level) const;
+        //The finest level with no more than maxBins bins, for drawing the whole sound maxBins pixels wide.
+        AZ::u32 FindLevel(AZ::u64 maxBins) const;
+
+    private:
+        WaveformPeaks() = default;
+
+        bool Validate(AZ::u64 size);
+
+        AZStd::unique_ptr<MappedFile> m_mappedFile;
+        AZStd::vector<AZ::u8> m_fileData; //Only if the file couldn't be mapped
+
+        const AZ::u8* m_data = nullptr;
+        const WaveformHeader* m_header = nullptr;
+        const WaveformLevel* m_levels = nullptr;
+    };
+}
@@ -5,4 +5,6 @@
 #      ../Include/Android/SuneAndroid.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
+    ../Common/Unix/SampleAllocator_Unix.cpp
 )
@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Sune;
+
+AZStd::unique_ptr<MappedFile> MappedFile::Open(const char* path, AZ::u64 offset, AZ::u64 size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || offset + size > static_cast<AZ::u64>(info.st_size))
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    const AZ::u64 pageSize = static_cast<AZ::u64>(sysconf(_SC_PAGESIZE));
+    const AZ::u64 viewOffset = offset - (offset % pageSize);
+    const AZ::u64 viewSize = size + (offset - viewOffset);
+
+    void* view = mmap(nullptr, viewSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(viewOffset));
+    //The mapping keeps its own reference to the file.
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    AZStd::unique_ptr<MappedFile> file(aznew MappedFile());
+    file->m_view = view;
+    file->m_viewSize = viewSize;
+    file->m_data = static_cast<AZ::u8*>(view) + (offset - viewOffset);
+    file->m_size = size;
+    return file;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_view != nullptr)
+    {
+        munmap(m_view, m_viewSize);
+    }
+}
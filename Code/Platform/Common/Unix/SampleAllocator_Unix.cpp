@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SampleAllocator.h"
+
+#include <AzCore/std/parallel/atomic.h>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace Sune;
+
+namespace
+{
+    //Reserved huge pages usually aren't configured, stop asking once the kernel has said no.
+    AZStd::atomic_bool g_hugePagesUnavailable = false;
+
+    size_t GetPageSize()
+    {
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+    }
+}
+
+void* SampleAllocator::AllocatePages(size_t bytes, bool& largePages)
+{
+    largePages = false;
+    bytes = AZ_SIZE_ALIGN_UP(bytes, GetPageSize());
+
+#if defined(MAP_HUGETLB)
+    if (bytes % SlabSize == 0 && !g_hugePagesUnavailable)
+    {
+        void* pages = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pages != MAP_FAILED)
+        {
+            largePages = true;
+            return pages;
+        }
+        g_hugePagesUnavailable = true;
+    }
+#endif
+
+    if (bytes < SlabSize)
+    {
+        void* pages = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return pages != MAP_FAILED ? pages : nullptr;
+    }
+
+    //Transparent huge pages only back aligned 2MB ranges, map a little extra and trim it down to a boundary.
+    void* mapping = mmap(nullptr, bytes + SlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    AZ::u8* start = static_cast<AZ::u8*>(mapping);
+    AZ::u8* pages = reinterpret_cast<AZ::u8*>(AZ_SIZE_ALIGN_UP(reinterpret_cast<uintptr_t>(start), SlabSize));
+    if (pages > start)
+    {
+        munmap(start, pages - start);
+    }
+    if (start + bytes + SlabSize > pages + bytes)
+    {
+        munmap(pages + bytes, (start + bytes + SlabSize) - (pages + bytes));
+    }
+
+#if defined(MADV_HUGEPAGE)
+    madvise(pages, bytes, MADV_HUGEPAGE);
+#endif
+    return pages;
+}
+
+void SampleAllocator::FreePages(void* pages, size_t bytes)
+{
+    munmap(pages, AZ_SIZE_ALIGN_UP(bytes, GetPageSize()));
+}
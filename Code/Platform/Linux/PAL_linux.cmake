@@ -1,6 +1,6 @@
 
 set(PAL_TRAIT_SUNE_SUPPORTED TRUE)
-set(PAL_TRAIT_SUNE_TEST_SUPPORTED FALSE)
-set(PAL_TRAIT_SUNE_EDITOR_TEST_SUPPORTED FALSE)
+set(PAL_TRAIT_SUNE_TEST_SUPPORTED TRUE)
+set(PAL_TRAIT_SUNE_EDITOR_TEST_SUPPORTED TRUE)
 
 set(LY_COMPILE_DEFINITIONS PUBLIC USE_KISS_FFT=1 __LINUX_ASOUND__=1 HAVE_STDINT_H=1 HAVE_SETENV=1 HAVE_SINF=1)
\ No newline at end of file
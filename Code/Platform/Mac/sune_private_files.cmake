@@ -5,4 +5,6 @@
 #      ../Include/Mac/SuneMac.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
+    ../Common/Unix/SampleAllocator_Unix.cpp
 )
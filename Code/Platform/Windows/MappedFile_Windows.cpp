@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/MappedFile.h"
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+
+using namespace Sune;
+
+AZStd::unique_ptr<MappedFile> MappedFile::Open(const char* path, AZ::u64 offset, AZ::u64 size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    AZStd::wstring widePath;
+    AZStd::to_wstring(widePath, path);
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || offset + size > static_cast<AZ::u64>(fileSize.QuadPart))
+    {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    const AZ::u64 granularity = systemInfo.dwAllocationGranularity;
+    const AZ::u64 viewOffset = offset - (offset % granularity);
+    const AZ::u64 viewSize = size + (offset - viewOffset);
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    void* view = nullptr;
+    if (mapping != nullptr)
+    {
+        view = MapViewOfFile(mapping, FILE_MAP_COPY,
+            static_cast<DWORD>(viewOffset >> 32), static_cast<DWORD>(viewOffset & 0xFFFFFFFF), static_cast<SIZE_T>(viewSize));
+        //The view keeps its own reference to the mapping and file.
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (view == nullptr)
+    {
+        return nullptr;
+    }
+
+    AZStd::unique_ptr<MappedFile> mappedFile(aznew MappedFile());
+    mappedFile->m_view = view;
+    mappedFile->m_viewSize = viewSize;
+    mappedFile->m_data = static_cast<AZ::u8*>(view) + (offset - viewOffset);
+    mappedFile->m_size = size;
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_view != nullptr)
+    {
+        UnmapViewOfFile(m_view);
+    }
+}
@@ -1,4 +1,4 @@
 
 set(PAL_TRAIT_SUNE_SUPPORTED TRUE)
-set(PAL_TRAIT_SUNE_TEST_SUPPORTED FALSE)
-set(PAL_TRAIT_SUNE_EDITOR_TEST_SUPPORTED FALSE)
+set(PAL_TRAIT_SUNE_TEST_SUPPORTED TRUE)
+set(PAL_TRAIT_SUNE_EDITOR_TEST_SUPPORTED TRUE)
@@ -0,0 +1,41 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SampleAllocator.h"
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/parallel/atomic.h>
+
+using namespace Sune;
+
+namespace
+{
+    //Large pages need SeLockMemoryPrivilege, which most processes don't have. Stop asking once we've been told no.
+    AZStd::atomic_bool g_largePagesUnavailable = false;
+}
+
+void* SampleAllocator::AllocatePages(size_t bytes, bool& largePages)
+{
+    largePages = false;
+
+    const SIZE_T largePageSize = GetLargePageMinimum();
+    if (largePageSize > 0 && bytes % largePageSize == 0 && !g_largePagesUnavailable)
+    {
+        if (void* pages = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE))
+        {
+            largePages = true;
+            return pages;
+        }
+        g_largePagesUnavailable = true;
+    }
+
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void SampleAllocator::FreePages(void* pages, [[maybe_unused]] size_t bytes)
+{
+    VirtualFree(pages, 0, MEM_RELEASE);
+}
@@ -5,4 +5,6 @@
 #      ../Include/Windows/SuneWindows.h
 
 set(FILES
+    MappedFile_Windows.cpp
+    SampleAllocator_Windows.cpp
 )
@@ -12,11 +12,15 @@ void Sune::SoundAssetSettings::Reflect(AZ::ReflectContext* context)
     if (sc)
     {
         sc->Class<SoundAssetSettings>()
-            ->Version(1)
+            ->Version(4)
             ->Field("presetName", &SoundAssetSettings::m_presetName)
             ->Field("format", &SoundAssetSettings::m_formatOverride)
             ->Field("loadMethod", &SoundAssetSettings::m_loadMethodOverride)
             ->Field("quality", &SoundAssetSettings::m_qualityOverride)
+            ->Field("precision", &SoundAssetSettings::m_precisionOverride)
+            ->Field("sampleRate", &SoundAssetSettings::m_sampleRateOverride)
+            ->Field("bitrate", &SoundAssetSettings::m_bitrateOverride)
+            ->Field("downmix", &SoundAssetSettings::m_downmixOverride)
             ->Field("volume", &SoundAssetSettings::m_volumeAdjustment)
             ;
     }
@@ -9,6 +9,7 @@
 #include "AzCore/RTTI/ReflectContext.h"
 #include "AzCore/RTTI/TypeInfoSimple.h"
 #include "Sune/SoundAsset.h"
+#include "SoundPresetSettings.h"
 
 namespace Sune
 {
@@ -25,6 +26,10 @@ namespace Sune
         AZStd::optional<AudioImportFormat> m_formatOverride;
         AZStd::optional<AudioLoadMethod> m_loadMethodOverride;
         AZStd::optional<float> m_qualityOverride;
+        AZStd::optional<SamplePrecision> m_precisionOverride;
+        AZStd::optional<AZ::u32> m_sampleRateOverride;
+        AZStd::optional<AZ::u32> m_bitrateOverride;
+        AZStd::optional<DownmixMode> m_downmixOverride;
 
         float m_volumeAdjustment = 1.0f;
 
@@ -39,6 +44,10 @@ namespace Sune
         AudioImportFormat m_format;
         AudioLoadMethod m_loadMethod;
         float m_quality;
+        SamplePrecision m_precision;
+        AZ::u32 m_sampleRate;
+        AZ::u32 m_bitrate;
+        DownmixMode m_downmix;
         float m_volumeAdjustment;
     };
 }
@@ -15,8 +15,9 @@ void SoundBuilderSettings::Reflect(AZ::ReflectContext* context)
     if (!sc)
         return;
     sc->Class<SoundBuilderSettings>()
-        ->Version(0)
+        ->Version(1)
         ->Field("enableStreaming", &SoundBuilderSettings::m_enableStreaming)
+        ->Field("parallelEncode", &SoundBuilderSettings::m_parallelEncode)
         ;
 }
 
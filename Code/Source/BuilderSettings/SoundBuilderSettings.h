@@ -19,6 +19,8 @@ namespace Sune
         AZ_CLASS_ALLOCATOR(SoundBuilderSettings, AZ::SystemAllocator);
 
         bool m_enableStreaming = true;
+        //Encode the parts of long Vorbis sounds on their own jobs. The output is the same either way, turning it off is for timing builds against.
+        bool m_parallelEncode = true;
 
         static void Reflect(AZ::ReflectContext* context);
     };
@@ -377,6 +377,10 @@ SoundAssetBuilderSettings SoundBuilderSettingsManager::GetSettings(
         finalSettings.m_format = assetSettings.m_formatOverride.value_or(preset->m_format);
         finalSettings.m_loadMethod = assetSettings.m_loadMethodOverride.value_or(preset->m_loadMethod);
         finalSettings.m_quality = assetSettings.m_qualityOverride.value_or(preset->m_quality);
+        finalSettings.m_precision = assetSettings.m_precisionOverride.value_or(preset->m_precision);
+        finalSettings.m_sampleRate = assetSettings.m_sampleRateOverride.value_or(preset->m_sampleRate);
+        finalSettings.m_bitrate = assetSettings.m_bitrateOverride.value_or(preset->m_bitrate);
+        finalSettings.m_downmix = assetSettings.m_downmixOverride.value_or(preset->m_downmix);
         finalSettings.m_volumeAdjustment = assetSettings.m_volumeAdjustment;
     }
     else
@@ -385,6 +389,10 @@ SoundAssetBuilderSettings SoundBuilderSettingsManager::GetSettings(
         finalSettings.m_format = AudioImportFormat::Vorbis;
         finalSettings.m_loadMethod = AudioLoadMethod::DecodeOnLoad;
         finalSettings.m_quality = 0.7f;
+        finalSettings.m_precision = SamplePrecision::Float32;
+        finalSettings.m_sampleRate = 0;
+        finalSettings.m_bitrate = 0;
+        finalSettings.m_downmix = DownmixMode::Off;
         finalSettings.m_volumeAdjustment = 1.0f;
     }
 
@@ -15,13 +15,23 @@ void SoundPresetSettings::Reflect(AZ::ReflectContext* context)
     auto sc = azrtti_cast<AZ::SerializeContext*>(context);
     if (!sc)
         return;
+    sc->Enum<DownmixMode>()
+        ->Value("Off", DownmixMode::Off)
+        ->Value("Auto", DownmixMode::Auto)
+        ->Value("Mono", DownmixMode::Mono)
+        ;
+
     sc->Class<SoundPresetSettings>()
-        ->Version(0)
+        ->Version(3)
         ->Field("name", &SoundPresetSettings::m_name)
         ->Field("description", &SoundPresetSettings::m_description)
         ->Field("format", &SoundPresetSettings::m_format)
         ->Field("loadMethod", &SoundPresetSettings::m_loadMethod)
         ->Field("quality", &SoundPresetSettings::m_quality)
+        ->Field("precision", &SoundPresetSettings::m_precision)
+        ->Field("sampleRate", &SoundPresetSettings::m_sampleRate)
+        ->Field("bitrate", &SoundPresetSettings::m_bitrate)
+        ->Field("downmix", &SoundPresetSettings::m_downmix)
         ;
 }
 
@@ -12,6 +12,14 @@
 
 namespace Sune
 {
+    //Whether the builder reduces the source to a single channel, spatialised sounds are panned from mono anyway.
+    enum class DownmixMode
+    {
+        Off,
+        Auto, //Only when every channel is near identical, so nothing audible is lost
+        Mono,
+    };
+
     // Single preset config
     struct SoundPresetSettings
     {
@@ -26,6 +34,12 @@ namespace Sune
         AudioImportFormat m_format = AudioImportFormat::Vorbis;
         AudioLoadMethod m_loadMethod = AudioLoadMethod::DecodeOnLoad;
         float m_quality = 0.8f;
+        SamplePrecision m_precision = SamplePrecision::Float32;
+        //Rate the asset is resampled to when built, usually the platform's output rate. 0 keeps the source rate.
+        AZ::u32 m_sampleRate = 0;
+        //Opus bits per second for every channel, 0 picks one from m_quality.
+        AZ::u32 m_bitrate = 0;
+        DownmixMode m_downmix = DownmixMode::Off;
 
         static void Reflect(AZ::ReflectContext* context);
     };
@@ -47,4 +61,6 @@ namespace Sune
 
         static void Reflect(AZ::ReflectContext* context);
     };
+
+    AZ_TYPE_INFO_SPECIALIZE(Sune::DownmixMode, "{6E1F4A8C-92B3-4D7E-A5C0-3B8D2F71E946}");
 }
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Adpcm.h"
+
+#include "SampleConversion.h"
+
+#include <AzCore/std/algorithm.h>
+#include <cstring>
+
+using namespace Sune;
+
+namespace
+{
+    constexpr AZ::s32 MaxStepIndex = 88;
+
+    constexpr AZ::s32 IndexTable[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8,
+    };
+
+    constexpr AZ::s32 StepTable[MaxStepIndex + 1] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+        19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+        130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+        876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+        5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+    };
+
+    //Applies one nibble, the encoder runs this too so both sides stay in step.
+    AZ::s32 DecodeNibble(AZ::s32& predictor, AZ::s32& stepIndex, AZ::u8 nibble)
+    {
+        const AZ::s32 step = StepTable[stepIndex];
+        AZ::s32 diff = step >> 3;
+        if (nibble & 4)
+        {
+            diff += step;
+        }
+        if (nibble & 2)
+        {
+            diff += step >> 1;
+        }
+        if (nibble & 1)
+        {
+            diff += step >> 2;
+        }
+
+        predictor = AZStd::clamp(nibble & 8 ? predictor - diff : predictor + diff, -32768, 32767);
+        stepIndex = AZStd::clamp(stepIndex + IndexTable[nibble], 0, MaxStepIndex);
+        return predictor;
+    }
+
+    AZ::u8 EncodeSample(Adpcm::EncoderState& state, AZ::s32 sample)
+    {
+        AZ::s32 step = StepTable[state.m_stepIndex];
+        AZ::s32 diff = sample - state.m_predictor;
+        AZ::u8 nibble = 0;
+        if (diff < 0)
+        {
+            nibble = 8;
+            diff = -diff;
+        }
+        for (AZ::u8 bit = 4; bit != 0; bit >>= 1)
+        {
+            if (diff >= step)
+            {
+                nibble |= bit;
+                diff -= step;
+            }
+            step >>= 1;
+        }
+
+        DecodeNibble(state.m_predictor, state.m_stepIndex, nibble);
+        return nibble;
+    }
+}
+
+AZ::u64 Adpcm::GetBlockCount(AZ::u64 frames)
+{
+    return (frames + BlockFrames - 1) / BlockFrames;
+}
+
+AZ::u64 Adpcm::GetPayloadSize(int channels, AZ::u64 frames)
+{
+    return GetBlockCount(frames) * channels * BlockSize;
+}
+
+void Adpcm::EncodeBlock(EncoderState& state, const float* in, size_t inStride, size_t frames, AZ::u8* block)
+{
+    AZ_Assert(frames <= BlockFrames, "An ADPCM block holds at most %zu frames.", BlockFrames);
+
+    const AZ::s16 predictor = static_cast<AZ::s16>(state.m_predictor);
+    memcpy(block, &predictor, sizeof(predictor));
+    block[2] = static_cast<AZ::u8>(state.m_stepIndex);
+    block[3] = 0;
+
+    //Quantised the same way as Int16 resident samples.
+    AZ::u16 pcm[BlockFrames] = {};
+    for (size_t i = 0; i < frames; ++i)
+    {
+        PackSamples(SamplePrecision::Int16, in + i * inStride, pcm + i, 1);
+    }
+
+    AZ::u8* nibbles = block + BlockHeaderSize;
+    for (size_t i = 0; i < BlockFrames; i += 2)
+    {
+        const AZ::u8 low = EncodeSample(state, static_cast<AZ::s16>(pcm[i]));
+        const AZ::u8 high = EncodeSample(state, static_cast<AZ::s16>(pcm[i + 1]));
+        nibbles[i / 2] = static_cast<AZ::u8>(low | (high << 4));
+    }
+}
+
+void Adpcm::DecodeBlock(const AZ::u8* block, float* out)
+{
+    AZ::s16 header;
+    memcpy(&header, block, sizeof(header));
+    AZ::s32 predictor = header;
+    AZ::s32 stepIndex = AZStd::min<AZ::s32>(block[2], MaxStepIndex);
+
+    //Every sample depends on the one before it, so only the conversion to float is vectorised.
+    AZ::u16 pcm[BlockFrames];
+    const AZ::u8* nibbles = block + BlockHeaderSize;
+    for (size_t i = 0; i < BlockFrames; i += 2)
+    {
+        const AZ::u8 byte = nibbles[i / 2];
+        pcm[i] = static_cast<AZ::u16>(DecodeNibble(predictor, stepIndex, byte & 0xf));
+        pcm[i + 1] = static_cast<AZ::u16>(DecodeNibble(predictor, stepIndex, byte >> 4));
+    }
+    UnpackSamples(SamplePrecision::Int16, pcm, out, BlockFrames);
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace Sune
+{
+    //IMA ADPCM, 4 bits a sample, split into blocks that each decode on their own.
+    //The payload is block major, every channel's copy of block 0 comes first, then block 1 and so on.
+    //A block starts with the decoder state it needs followed by two samples a byte, low nibble first.
+    namespace Adpcm
+    {
+        //One LabSound render quantum, so a voice decodes one block a quantum.
+        static constexpr size_t BlockFrames = 128;
+        static constexpr size_t BlockHeaderSize = 4; //s16 predictor, u8 step index, u8 reserved
+        static constexpr size_t BlockSize = BlockHeaderSize + BlockFrames / 2;
+
+        //The encoder state carried from one block to the next.
+        struct EncoderState
+        {
+            AZ::s32 m_predictor = 0;
+            AZ::s32 m_stepIndex = 0;
+        };
+
+        AZ::u64 GetBlockCount(AZ::u64 frames);
+        AZ::u64 GetPayloadSize(int channels, AZ::u64 frames);
+
+        //Encodes up to BlockFrames samples of one channel, stride is in samples.
+        //Anything past frames is padded with silence.
+        void EncodeBlock(EncoderState& state, const float* in, size_t inStride, size_t frames, AZ::u8* block);
+
+        //Decodes a whole block to float, this runs on the audio thread.
+        void DecodeBlock(const AZ::u8* block, float* out);
+    }
+}
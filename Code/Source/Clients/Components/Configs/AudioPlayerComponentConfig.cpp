@@ -18,14 +18,21 @@ void AudioPlayerComponentConfig::Reflect(AZ::ReflectContext* context)
             ->Value("Inverse", lab::PannerNode::DistanceModel::INVERSE_DISTANCE)
             ->Value("Exponential", lab::PannerNode::DistanceModel::EXPONENTIAL_DISTANCE);
 
+        sc->Enum<SoundLoadPriority>()
+            ->Value("Critical", SoundLoadPriority::Critical)
+            ->Value("Nearby", SoundLoadPriority::Nearby)
+            ->Value("Ambience", SoundLoadPriority::Ambience)
+            ->Value("Prefetch", SoundLoadPriority::Prefetch);
+
         sc->Class<AudioPlayerComponentConfig>()
-            ->Version(0)
+            ->Version(1)
             ->Field("audioAsset", &AudioPlayerComponentConfig::m_audioAsset)
             ->Field("audioBus", &AudioPlayerComponentConfig::m_audioBus)
             ->Field("playMultiple", &AudioPlayerComponentConfig::m_playMultiple)
             ->Field("gain", &AudioPlayerComponentConfig::m_gain)
             ->Field("loop", &AudioPlayerComponentConfig::m_loop)
             ->Field("autoPlay", &AudioPlayerComponentConfig::m_autoPlay)
+            ->Field("loadPriority", &AudioPlayerComponentConfig::m_loadPriority)
         ;
     }
 }
@@ -8,6 +8,7 @@
 #include "AzCore/Component/ComponentBus.h"
 #include "LabSound/core/PannerNode.h"
 #include "Sune/SoundAsset.h"
+#include "Sune/SuneBus.h"
 
 namespace Sune
 {
@@ -23,6 +24,7 @@ namespace Sune
         float m_gain = 1.0f;
         bool m_loop = false;
         bool m_autoPlay = true;
+        SoundLoadPriority m_loadPriority = SoundLoadPriority::Nearby;
     };
 } // Sune
 
@@ -71,6 +71,7 @@ void AudioPlayerComponentController::Deactivate()
 void AudioPlayerComponentController::OnConfigurationUpdated()
 {
     SoundPlayerRequestBus::Event(m_playerId, &SoundPlayerRequestBus::Events::SetBus, m_config.m_audioBus);
+    SoundPlayerRequestBus::Event(m_playerId, &SoundPlayerRequestBus::Events::SetLoadPriority, m_config.m_loadPriority);
     SoundPlayerRequestBus::Event(m_playerId, &SoundPlayerRequestBus::Events::SetAsset, m_config.m_audioAsset.GetId());
     SoundPlayerRequestBus::Event(m_playerId, &SoundPlayerRequestBus::Events::SetPlayMultiple, m_config.m_playMultiple);
     SoundPlayerRequestBus::Event(m_playerId, &SoundPlayerRequestBus::Events::SetGain, m_config.m_gain);
@@ -0,0 +1,401 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "DecodeCache.h"
+
+#include "MappedFile.h"
+
+#include <Sune/SoundAsset.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <cstdlib>
+#include <cstring>
+
+using namespace Sune;
+
+namespace
+{
+    constexpr AZ::u32 CacheFileMagic = 0x4D435053; //"SPCM"
+    constexpr AZ::u32 CacheFileVersion = 1;
+    constexpr const char* EntryExtension = ".pcm";
+    constexpr const char* IndexFileName = "index.txt";
+
+    //Written at the start of every entry, the PCM follows at DecodeCache::DataOffset.
+    //The cache never leaves the machine so it's kept in native byte order.
+    struct CacheFileHeader
+    {
+        AZ::u32 m_magic = CacheFileMagic;
+        AZ::u32 m_version = CacheFileVersion;
+        AZ::u32 m_precision = 0;
+        AZ::s32 m_channels = 0;
+        AZ::s32 m_sampleRate = 0;
+        AZ::u32 m_reserved = 0;
+        AZ::u64 m_totalSamples = 0;
+    };
+    static_assert(sizeof(CacheFileHeader) <= DecodeCache::DataOffset);
+
+    CacheFileHeader MakeHeader(const SoundAsset& asset)
+    {
+        CacheFileHeader header;
+        header.m_precision = static_cast<AZ::u32>(asset.m_precision);
+        header.m_channels = asset.m_channels;
+        header.m_sampleRate = asset.m_sampleRate;
+        header.m_totalSamples = asset.m_totalSamples;
+        return header;
+    }
+}
+
+DecodeCache::DecodeCache(const char* directory, AZ::u64 maxSizeBytes)
+    : m_directory(directory)
+    , m_maxSizeBytes(maxSizeBytes)
+{
+    if (DecodeCacheInterface::Get() == nullptr)
+    {
+        DecodeCacheInterface::Register(this);
+    }
+
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (fileIO == nullptr || !fileIO->CreatePath(m_directory.c_str()))
+    {
+        AZ_Warning("DecodeCache", false, "Failed to create the decode cache at '%s', nothing will be cached.", m_directory.c_str());
+        m_maxSizeBytes = 0;
+        return;
+    }
+
+    //Entries on disk are the source of truth, the index only remembers the order they were used in.
+    AZStd::vector<AZStd::string> staleFiles;
+    fileIO->FindFiles(m_directory.c_str(), "*", [&](const char* path)
+    {
+        AZStd::string name;
+        AZ::StringFunc::Path::GetFullFileName(path, name);
+        if (name.ends_with(EntryExtension))
+        {
+            AZ::u64 size = 0;
+            fileIO->Size(path, size);
+            m_entries[name].m_size = size;
+            m_sizeBytes += size;
+        }
+        else if (name.ends_with(".tmp"))
+        {
+            //Left behind by a store that never finished.
+            staleFiles.push_back(path);
+        }
+        return true;
+    });
+
+    for (const AZStd::string& path : staleFiles)
+    {
+        fileIO->Remove(path.c_str());
+    }
+
+    ReadIndex();
+
+    AZStd::scoped_lock lock(m_mutex);
+    Evict({});
+}
+
+DecodeCache::~DecodeCache()
+{
+    if (m_maxSizeBytes > 0)
+    {
+        WriteIndex();
+    }
+
+    if (DecodeCacheInterface::Get() == this)
+    {
+        DecodeCacheInterface::Unregister(this);
+    }
+}
+
+void* DecodeCache::Load(SoundAsset& asset)
+{
+    const AZStd::string name = GetEntryName(asset);
+    if (name.empty() || m_maxSizeBytes == 0)
+    {
+        return nullptr;
+    }
+
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        auto it = m_entries.find(name);
+        if (it == m_entries.end())
+        {
+            ++m_misses;
+            return nullptr;
+        }
+        it->second.m_lastUse = ++m_useCounter;
+    }
+
+    const AZStd::string path = GetEntryPath(name);
+    const AZ::u64 dataSize = asset.m_totalSamples * GetSampleSize(asset.m_precision);
+
+    AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    CacheFileHeader header;
+    const CacheFileHeader expected = MakeHeader(asset);
+    if (!file.IsOpen()
+        || file.GetLength() < DataOffset + dataSize
+        || file.Read(sizeof(header), &header) != sizeof(header)
+        || memcmp(&header, &expected, sizeof(header)) != 0)
+    {
+        AZ_Warning("DecodeCache", false, "Decode cache entry '%s' is out of date, dropping it.", name.c_str());
+        file.Close();
+        Forget(name);
+        ++m_misses;
+        return nullptr;
+    }
+
+    void* data = nullptr;
+    char resolvedPath[AZ_MAX_PATH_LEN] = {};
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (fileIO->ResolvePath(path.c_str(), resolvedPath, sizeof(resolvedPath)))
+    {
+        if (AZStd::unique_ptr<MappedFile> mappedFile = MappedFile::Open(resolvedPath, DataOffset, dataSize))
+        {
+            data = mappedFile->GetData();
+            asset.m_sampleOwner = AZStd::shared_ptr<MappedFile>(mappedFile.release());
+        }
+    }
+
+    if (data == nullptr)
+    {
+        if (asset.m_precision == SamplePrecision::Float32)
+        {
+            asset.m_samples.Allocate(asset.m_totalSamples, asset.m_sampleGroup);
+            data = asset.m_samples.data();
+        }
+        else
+        {
+            asset.m_compactSamples.Allocate(asset.m_totalSamples, asset.m_sampleGroup);
+            data = asset.m_compactSamples.data();
+        }
+
+        file.Seek(static_cast<AZ::IO::OffsetType>(DataOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        if (file.Read(dataSize, data) != dataSize)
+        {
+            AZ_Warning("DecodeCache", false, "Failed to read decode cache entry '%s'.", name.c_str());
+            asset.m_samples.Reset();
+            asset.m_compactSamples.Reset();
+            ++m_misses;
+            return nullptr;
+        }
+    }
+
+    ++m_hits;
+    return data;
+}
+
+void DecodeCache::Store(const SoundAsset& asset)
+{
+    const AZStd::string name = GetEntryName(asset);
+    const AZ::u64 dataSize = asset.m_totalSamples * GetSampleSize(asset.m_precision);
+    if (name.empty() || asset.m_sampleData == nullptr || dataSize == 0 || DataOffset + dataSize > m_maxSizeBytes)
+    {
+        return;
+    }
+
+    AZStd::string tempPath;
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        //Another load of the same asset got here first.
+        if (m_entries.contains(name))
+        {
+            return;
+        }
+        tempPath = AZStd::string::format("%s.%llu.tmp", GetEntryPath(name).c_str(), ++m_useCounter);
+    }
+
+    //Written under a temporary name so a crash never leaves a truncated entry behind.
+    {
+        AZ::IO::FileIOStream file(tempPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!file.IsOpen())
+        {
+            AZ_Warning("DecodeCache", false, "Failed to open '%s' for writing.", tempPath.c_str());
+            return;
+        }
+
+        AZStd::vector<AZ::u8> header(DataOffset, 0);
+        const CacheFileHeader fileHeader = MakeHeader(asset);
+        memcpy(header.data(), &fileHeader, sizeof(fileHeader));
+        if (file.Write(header.size(), header.data()) != header.size() || file.Write(dataSize, asset.m_sampleData) != dataSize)
+        {
+            AZ_Warning("DecodeCache", false, "Failed to write decode cache entry '%s'.", name.c_str());
+            file.Close();
+            AZ::IO::FileIOBase::GetInstance()->Remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (!fileIO->Rename(tempPath.c_str(), GetEntryPath(name).c_str()))
+    {
+        fileIO->Remove(tempPath.c_str());
+        return;
+    }
+
+    ++m_stores;
+    Touch(name, DataOffset + dataSize);
+}
+
+DecodeCacheStats DecodeCache::GetStats() const
+{
+    DecodeCacheStats stats;
+    stats.m_hits = m_hits;
+    stats.m_misses = m_misses;
+    stats.m_stores = m_stores;
+    stats.m_evictions = m_evictions;
+    stats.m_maxSizeBytes = m_maxSizeBytes;
+
+    AZStd::scoped_lock lock(m_mutex);
+    stats.m_sizeBytes = m_sizeBytes;
+    return stats;
+}
+
+AZStd::string DecodeCache::GetEntryName(const SoundAsset& asset) const
+{
+    if (asset.m_payloadHash.IsNull())
+    {
+        return {};
+    }
+
+    //The payload hash changes whenever the product is rebuilt with different content or settings.
+    const AZ::Data::AssetId& assetId = asset.GetId();
+    return AZStd::string::format("%s-%u-%s-%u%s",
+        assetId.m_guid.ToString<AZStd::string>(false, false).c_str(),
+        assetId.m_subId,
+        asset.m_payloadHash.ToString<AZStd::string>(false, false).c_str(),
+        static_cast<AZ::u32>(asset.m_precision),
+        EntryExtension);
+}
+
+AZStd::string DecodeCache::GetEntryPath(const AZStd::string& name) const
+{
+    return AZStd::string::format("%s/%s", m_directory.c_str(), name.c_str());
+}
+
+void DecodeCache::Touch(const AZStd::string& name, AZ::u64 size)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    Entry& entry = m_entries[name];
+    m_sizeBytes = m_sizeBytes - entry.m_size + size;
+    entry.m_size = size;
+    entry.m_lastUse = ++m_useCounter;
+    Evict(name);
+}
+
+void DecodeCache::Forget(const AZStd::string& name)
+{
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        auto it = m_entries.find(name);
+        if (it == m_entries.end())
+        {
+            return;
+        }
+        m_sizeBytes -= it->second.m_size;
+        m_entries.erase(it);
+    }
+    AZ::IO::FileIOBase::GetInstance()->Remove(GetEntryPath(name).c_str());
+}
+
+//Expects m_mutex to be held.
+void DecodeCache::Evict(const AZStd::string& keep)
+{
+    if (m_sizeBytes <= m_maxSizeBytes)
+    {
+        return;
+    }
+
+    AZStd::vector<AZStd::pair<AZ::u64, AZStd::string>> candidates;
+    candidates.reserve(m_entries.size());
+    for (const auto& [name, entry] : m_entries)
+    {
+        if (name != keep)
+        {
+            candidates.emplace_back(entry.m_lastUse, name);
+        }
+    }
+    AZStd::sort(candidates.begin(), candidates.end());
+
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    for (const auto& candidate : candidates)
+    {
+        if (m_sizeBytes <= m_maxSizeBytes)
+        {
+            break;
+        }
+
+        //Entries that are still mapped can't be removed on every platform, they get another chance next time.
+        if (!fileIO->Remove(GetEntryPath(candidate.second).c_str()))
+        {
+            continue;
+        }
+
+        auto it = m_entries.find(candidate.second);
+        m_sizeBytes -= it->second.m_size;
+        m_entries.erase(it);
+        ++m_evictions;
+    }
+}
+
+void DecodeCache::ReadIndex()
+{
+    const AZStd::string path = GetEntryPath(IndexFileName);
+    AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    if (!file.IsOpen())
+    {
+        return;
+    }
+
+    AZStd::string contents;
+    contents.resize_no_construct(file.GetLength());
+    if (file.Read(contents.size(), contents.data()) != contents.size())
+    {
+        return;
+    }
+
+    //One "<name> <last use>" per line, entries missing from the index are treated as the oldest.
+    AZStd::vector<AZStd::string> lines;
+    AZ::StringFunc::Tokenize(contents, lines, "\n");
+
+    AZStd::scoped_lock lock(m_mutex);
+    for (const AZStd::string& line : lines)
+    {
+        const size_t split = line.rfind(' ');
+        if (split == AZStd::string::npos)
+        {
+            continue;
+        }
+
+        auto it = m_entries.find(line.substr(0, split));
+        if (it != m_entries.end())
+        {
+            it->second.m_lastUse = strtoull(line.c_str() + split + 1, nullptr, 10);
+            m_useCounter = AZStd::max(m_useCounter, it->second.m_lastUse);
+        }
+    }
+}
+
+void DecodeCache::WriteIndex()
+{
+    AZStd::string contents;
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        for (const auto& [name, entry] : m_entries)
+        {
+            contents += AZStd::string::format("%s %llu\n", name.c_str(), entry.m_lastUse);
+        }
+    }
+
+    const AZStd::string path = GetEntryPath(IndexFileName);
+    AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+    if (!file.IsOpen() || file.Write(contents.size(), contents.data()) != contents.size())
+    {
+        AZ_Warning("DecodeCache", false, "Failed to write the decode cache index '%s'.", path.c_str());
+    }
+}
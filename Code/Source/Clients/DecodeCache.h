@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace Sune
+{
+    class SoundAsset;
+
+    struct DecodeCacheStats
+    {
+        AZ::u64 m_hits = 0;
+        AZ::u64 m_misses = 0;
+        AZ::u64 m_stores = 0;
+        AZ::u64 m_evictions = 0;
+        AZ::u64 m_sizeBytes = 0;
+        AZ::u64 m_maxSizeBytes = 0;
+    };
+
+    //Local disk cache of decoded planar PCM so compressed assets only get decoded once per machine.
+    //Entries are keyed by asset id, product payload hash and resident precision, and evicted least recently used first.
+    //Enabled with /Audio/DecodeCache/Enabled, capped by /Audio/DecodeCache/MaxSizeMB.
+    class DecodeCache
+    {
+    public:
+        AZ_RTTI(DecodeCache, "{C6F0A2D4-1B7E-4E93-8D25-9A4F3E61B0C8}");
+        AZ_CLASS_ALLOCATOR(DecodeCache, AZ::SystemAllocator);
+
+        static constexpr AZ::u64 DefaultMaxSizeMB = 1024;
+        //PCM starts on a page boundary so hits can be mapped.
+        static constexpr AZ::u64 DataOffset = 4096;
+
+        DecodeCache(const char* directory, AZ::u64 maxSizeBytes);
+        virtual ~DecodeCache();
+
+        //Maps or reads the asset's planar samples from the cache, returns null on a miss.
+        //Safe to call from any asset loading thread.
+        void* Load(SoundAsset& asset);
+        //Writes the asset's decoded samples, evicting older entries to stay under the cap.
+        void Store(const SoundAsset& asset);
+
+        DecodeCacheStats GetStats() const;
+
+    private:
+        struct Entry
+        {
+            AZ::u64 m_size = 0;
+            AZ::u64 m_lastUse = 0;
+        };
+
+        AZStd::string GetEntryName(const SoundAsset& asset) const;
+        AZStd::string GetEntryPath(const AZStd::string& name) const;
+        void Touch(const AZStd::string& name, AZ::u64 size);
+        void Forget(const AZStd::string& name);
+        void Evict(const AZStd::string& keep);
+        void ReadIndex();
+        void WriteIndex();
+
+        AZStd::string m_directory;
+        AZ::u64 m_maxSizeBytes = 0;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, Entry> m_entries;
+        AZ::u64 m_sizeBytes = 0;
+        AZ::u64 m_useCounter = 0;
+
+        AZStd::atomic<AZ::u64> m_hits = 0;
+        AZStd::atomic<AZ::u64> m_misses = 0;
+        AZStd::atomic<AZ::u64> m_stores = 0;
+        AZStd::atomic<AZ::u64> m_evictions = 0;
+    };
+
+    using DecodeCacheInterface = AZ::Interface<DecodeCache>;
+}
@@ -0,0 +1,248 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "OpusPacketDecoder.h"
+
+#include <AzCore/std/algorithm.h>
+
+using namespace Sune;
+
+bool OpusPacketDecoder::IsSupportedSampleRate(int sampleRate)
+{
+    return sampleRate == 8000 || sampleRate == 12000 || sampleRate == 16000 || sampleRate == 24000 || sampleRate == 48000;
+}
+
+OpusPacketDecoder::~OpusPacketDecoder()
+{
+    Close();
+}
+
+bool OpusPacketDecoder::Open(AZ::IO::GenericStream* stream, AZ::u64 payloadSize)
+{
+    Close();
+
+    m_stream = stream;
+    m_payloadStart = stream->GetCurPos();
+    m_payloadEnd = m_payloadStart + payloadSize;
+
+    if (payloadSize < sizeof(m_header) || stream->Read(sizeof(m_header), &m_header) != sizeof(m_header)
+        || m_header.m_magic != OpusPayloadHeader::Magic || m_header.m_version != OpusPayloadHeader::CurrentVersion)
+    {
+        AZ_Error("OpusPacketDecoder", false, "Payload doesn't start with a valid Opus header.");
+        m_header = {};
+        return false;
+    }
+
+    const int sampleRate = static_cast<int>(m_header.m_sampleRate);
+    if (!IsSupportedSampleRate(sampleRate) || m_header.m_channels < 1 || m_header.m_channels > 2
+        || m_header.m_frameSize == 0 || m_header.m_frameSize > m_header.m_sampleRate / 10)
+    {
+        AZ_Error("OpusPacketDecoder", false, "Opus header has %u channels at %uHz with %u frames per packet, which can't be decoded.",
+            m_header.m_channels, m_header.m_sampleRate, m_header.m_frameSize);
+        m_header = {};
+        return false;
+    }
+
+    int error = OPUS_OK;
+    m_decoder = opus_decoder_create(sampleRate, static_cast<int>(m_header.m_channels), &error);
+    if (error != OPUS_OK)
+    {
+        AZ_Error("OpusPacketDecoder", false, "Failed to create the Opus decoder: %s.", opus_strerror(error));
+        m_decoder = nullptr;
+        m_header = {};
+        return false;
+    }
+
+    m_packet.resize_no_construct(MaxPacketSize);
+    m_pending.resize_no_construct(m_header.m_frameSize * m_header.m_channels);
+    m_audioStart = stream->GetCurPos();
+    m_skip = m_header.m_preSkip;
+    m_position = 0;
+    return true;
+}
+
+void OpusPacketDecoder::Close()
+{
+    if (m_decoder)
+    {
+        opus_decoder_destroy(m_decoder);
+        m_decoder = nullptr;
+    }
+
+    m_stream = nullptr;
+    m_header = {};
+    m_packetsLeftInPage = 0;
+    m_pendingStart = 0;
+    m_pendingFrames = 0;
+    m_skip = 0;
+    m_position = 0;
+    m_error = false;
+    m_endOfStream = false;
+}
+
+int OpusPacketDecoder::Decode(float* const* channels, int maxFrames)
+{
+    if (!m_decoder)
+    {
+        return -1;
+    }
+
+    const AZ::u32 channelCount = m_header.m_channels;
+    int written = 0;
+    while (written < maxFrames)
+    {
+        if (m_pendingFrames > 0)
+        {
+            //The last packet is padded out to a whole frame, stop at the real end.
+            const AZ::u64 remaining = m_header.m_totalFrames - AZStd::min(m_position, m_header.m_totalFrames);
+            const AZ::u64 wanted = AZStd::min<AZ::u64>(m_pendingFrames, static_cast<AZ::u64>(maxFrames - written));
+            const AZ::u32 frames = static_cast<AZ::u32>(AZStd::min(wanted, remaining));
+            if (frames == 0)
+            {
+                m_pendingFrames = 0;
+                m_endOfStream = true;
+                break;
+            }
+
+            const float* pending = m_pending.data() + m_pendingStart * channelCount;
+            for (AZ::u32 ch = 0; ch < channelCount; ++ch)
+            {
+                float* channel = channels[ch] + written;
+                for (AZ::u32 i = 0; i < frames; ++i)
+                {
+                    channel[i] = pending[i * channelCount + ch];
+                }
+            }
+            m_pendingStart += frames;
+            m_pendingFrames -= frames;
+            m_position += frames;
+            written += frames;
+            continue;
+        }
+
+        if (m_position >= m_header.m_totalFrames || !DecodePacket())
+        {
+            m_endOfStream = true;
+            break;
+        }
+    }
+
+    return m_error && written == 0 ? -1 : written;
+}
+
+bool OpusPacketDecoder::Rewind()
+{
+    if (!m_decoder)
+    {
+        return false;
+    }
+
+    m_stream->Seek(static_cast<AZ::IO::OffsetType>(m_audioStart), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    opus_decoder_ctl(m_decoder, OPUS_RESET_STATE);
+
+    m_packetsLeftInPage = 0;
+    m_pendingFrames = 0;
+    m_skip = m_header.m_preSkip;
+    m_position = 0;
+    m_error = false;
+    m_endOfStream = false;
+    return true;
+}
+
+bool OpusPacketDecoder::SeekToPage(AZ::u64 pageOffset, AZ::u64 frame)
+{
+    if (!m_decoder)
+    {
+        return false;
+    }
+
+    m_stream->Seek(static_cast<AZ::IO::OffsetType>(m_payloadStart + pageOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    opus_decoder_ctl(m_decoder, OPUS_RESET_STATE);
+    m_packetsLeftInPage = 0;
+    m_pendingFrames = 0;
+    m_error = false;
+    m_endOfStream = false;
+
+    OpusPageHeader page;
+    if (!ReadPageHeader(page))
+    {
+        AZ_Error("OpusPacketDecoder", false, "There's no Opus page at the seek offset.");
+        return false;
+    }
+
+    //Output frames are offset by the encoder delay, the page starts at a whole packet of the decoded stream.
+    const AZ::u64 pageStart = static_cast<AZ::u64>(page.m_firstPacket) * m_header.m_frameSize;
+    const AZ::u64 target = frame + m_header.m_preSkip;
+    if (pageStart > target)
+    {
+        AZ_Error("OpusPacketDecoder", false, "Seek page starts after the requested frame.");
+        return false;
+    }
+
+    //Everything from the page to the frame is decoded and dropped, which also lets the decoder settle after the reset.
+    m_skip = target - pageStart;
+    m_position = frame;
+    return true;
+}
+
+bool OpusPacketDecoder::ReadPageHeader(OpusPageHeader& page)
+{
+    if (m_stream->GetCurPos() + sizeof(page) > m_payloadEnd || m_stream->Read(sizeof(page), &page) != sizeof(page))
+    {
+        return false;
+    }
+    m_packetsLeftInPage = page.m_packetCount;
+    return page.m_packetCount > 0;
+}
+
+bool OpusPacketDecoder::DecodePacket()
+{
+    while (true)
+    {
+        OpusPageHeader page;
+        if (m_packetsLeftInPage == 0 && !ReadPageHeader(page))
+        {
+            return false;
+        }
+
+        AZ::u16 size = 0;
+        if (m_stream->GetCurPos() + sizeof(size) > m_payloadEnd || m_stream->Read(sizeof(size), &size) != sizeof(size))
+        {
+            return false;
+        }
+        --m_packetsLeftInPage;
+
+        if (size > m_packet.size() || m_stream->GetCurPos() + size > m_payloadEnd || m_stream->Read(size, m_packet.data()) != size)
+        {
+            AZ_Error("OpusPacketDecoder", false, "Opus packet runs past the end of the payload.");
+            m_error = true;
+            return false;
+        }
+
+        const int frames = opus_decode_float(m_decoder, m_packet.data(), size, m_pending.data(), static_cast<int>(m_header.m_frameSize), 0);
+        if (frames < 0)
+        {
+            AZ_Error("OpusPacketDecoder", false, "Failed to decode an Opus packet: %s.", opus_strerror(frames));
+            m_error = true;
+            return false;
+        }
+
+        m_pendingStart = 0;
+        m_pendingFrames = static_cast<AZ::u32>(frames);
+        if (m_skip > 0)
+        {
+            const AZ::u32 skipped = static_cast<AZ::u32>(AZStd::min<AZ::u64>(m_skip, m_pendingFrames));
+            m_pendingStart = skipped;
+            m_pendingFrames -= skipped;
+            m_skip -= skipped;
+        }
+
+        if (m_pendingFrames > 0)
+        {
+            return true;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "SoundDecoder.h"
+
+#include <AzCore/std/containers/vector.h>
+
+#include <opus.h>
+
+namespace Sune
+{
+    //Opus payloads are an OpusPayloadHeader followed by pages of packets, every packet is FrameMilliseconds long.
+    //Each page is an OpusPageHeader then m_packetCount packets, each prefixed with its size as a u16.
+    //Everything is little endian, like every platform assets are built for.
+    struct OpusPayloadHeader
+    {
+        static constexpr AZ::u32 Magic = 0x5355504F; //"OPUS"
+        static constexpr AZ::u32 CurrentVersion = 1;
+
+        AZ::u32 m_magic = Magic;
+        AZ::u32 m_version = CurrentVersion;
+        AZ::u32 m_channels = 0;
+        AZ::u32 m_sampleRate = 0;
+        AZ::u32 m_preSkip = 0; //Encoder delay dropped from the start of the output
+        AZ::u32 m_frameSize = 0; //Frames per packet
+        AZ::u64 m_totalFrames = 0; //Anything the last packet decodes past this is padding
+    };
+
+    struct OpusPageHeader
+    {
+        AZ::u32 m_firstPacket = 0;
+        AZ::u32 m_packetCount = 0;
+    };
+
+    //Decodes the packet stream the builder writes for AudioImportFormat::Opus.
+    class OpusPacketDecoder
+        : public SoundDecoder
+    {
+    public:
+        static constexpr int FrameMilliseconds = 20;
+        //Packets in a page, a page is the smallest unit that can be seeked to.
+        static constexpr AZ::u32 PagePackets = 10;
+        //Opus needs this much audio after a reset before its output matches a continuous decode.
+        static constexpr int PreRollMilliseconds = 80;
+        //The largest packet the encoder can produce for a single frame.
+        static constexpr size_t MaxPacketSize = 1275 * 3;
+
+        //Rates Opus can encode and decode at natively.
+        static bool IsSupportedSampleRate(int sampleRate);
+
+        OpusPacketDecoder() = default;
+        ~OpusPacketDecoder() override;
+
+        OpusPacketDecoder(const OpusPacketDecoder&) = delete;
+        OpusPacketDecoder& operator=(const OpusPacketDecoder&) = delete;
+
+        bool Open(AZ::IO::GenericStream* stream, AZ::u64 payloadSize) override;
+        void Close() override;
+
+        int Decode(float* const* channels, int maxFrames) override;
+
+        bool Rewind() override;
+
+        //pageOffset must be the start of a page that begins at or before frame.
+        bool SeekToPage(AZ::u64 pageOffset, AZ::u64 frame) override;
+
+        bool IsOpen() const override { return m_decoder != nullptr; }
+        bool IsEndOfStream() const override { return m_endOfStream; }
+        int GetChannels() const override { return static_cast<int>(m_header.m_channels); }
+        int GetSampleRate() const override { return static_cast<int>(m_header.m_sampleRate); }
+
+    private:
+        bool ReadPageHeader(OpusPageHeader& page);
+        //Decodes the next packet into m_pending, false at the end of the stream or on error.
+        bool DecodePacket();
+
+        AZ::IO::GenericStream* m_stream = nullptr;
+        AZ::u64 m_payloadStart = 0;
+        AZ::u64 m_payloadEnd = 0;
+        AZ::u64 m_audioStart = 0;
+
+        ::OpusDecoder* m_decoder = nullptr;
+        OpusPayloadHeader m_header;
+
+        AZ::u32 m_packetsLeftInPage = 0;
+        AZStd::vector<AZ::u8> m_packet;
+        //Interleaved output of the last packet that hasn't been returned yet.
+        AZStd::vector<float> m_pending;
+        AZ::u32 m_pendingStart = 0;
+        AZ::u32 m_pendingFrames = 0;
+        //Frames still to be dropped before output starts, the encoder delay or the lead in to a seek.
+        AZ::u64 m_skip = 0;
+        //Frame the next returned sample belongs to.
+        AZ::u64 m_position = 0;
+
+        bool m_error = false;
+        bool m_endOfStream = false;
+    };
+}
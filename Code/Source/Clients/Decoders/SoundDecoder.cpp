@@ -0,0 +1,25 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundDecoder.h"
+
+#include "OpusPacketDecoder.h"
+#include "VorbisDecoder.h"
+
+using namespace Sune;
+
+AZStd::unique_ptr<SoundDecoder> Sune::CreateSoundDecoder(AudioImportFormat format)
+{
+    switch (format)
+    {
+    case AudioImportFormat::Vorbis:
+        return AZStd::make_unique<VorbisDecoder>();
+    case AudioImportFormat::Opus:
+        return AZStd::make_unique<OpusPacketDecoder>();
+    default:
+        return nullptr;
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include "Sune/SoundAsset.h"
+
+namespace Sune
+{
+    //Incremental decoder for a compressed payload, pulls data from a stream on demand.
+    //Shared by decode on load, the background tail decode and streaming so they work with any compressed format.
+    class SoundDecoder
+    {
+    public:
+        virtual ~SoundDecoder() = default;
+
+        //Reads the format headers starting at the streams current position.
+        //The stream must outlive the decoder, payloadSize limits how far the decoder will read.
+        virtual bool Open(AZ::IO::GenericStream* stream, AZ::u64 payloadSize) = 0;
+        virtual void Close() = 0;
+
+        //Decodes up to maxFrames into the planar channel pointers.
+        //Returns the frames written, 0 once the end of the stream is reached or -1 on error.
+        virtual int Decode(float* const* channels, int maxFrames) = 0;
+
+        //Moves back to the first audio frame.
+        virtual bool Rewind() = 0;
+
+        //Restarts decoding at the seek point at pageOffset bytes into the payload, the next Decode returns frame onwards.
+        //pageOffset comes from the asset's segments or seek table for a frame at or before frame.
+        virtual bool SeekToPage(AZ::u64 pageOffset, AZ::u64 frame) = 0;
+
+        virtual bool IsOpen() const = 0;
+        virtual bool IsEndOfStream() const = 0;
+        virtual int GetChannels() const = 0;
+        virtual int GetSampleRate() const = 0;
+    };
+
+    //Null for formats that aren't decoded incrementally.
+    AZStd::unique_ptr<SoundDecoder> CreateSoundDecoder(AudioImportFormat format);
+}
@@ -0,0 +1,302 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "VorbisDecoder.h"
+
+#include <AzCore/std/algorithm.h>
+#include <cstring>
+
+using namespace Sune;
+
+VorbisDecoder::VorbisDecoder()
+{
+    ogg_sync_init(&m_syncState);
+    vorbis_info_init(&m_info);
+    vorbis_comment_init(&m_comment);
+}
+
+VorbisDecoder::~VorbisDecoder()
+{
+    Close();
+    ogg_sync_clear(&m_syncState);
+    vorbis_comment_clear(&m_comment);
+    vorbis_info_clear(&m_info);
+}
+
+bool VorbisDecoder::Open(AZ::IO::GenericStream* stream, AZ::u64 payloadSize)
+{
+    Close();
+
+    m_stream = stream;
+    m_payloadStart = stream->GetCurPos();
+    m_payloadEnd = m_payloadStart + payloadSize;
+
+    ogg_page page;
+    if (!ReadPage(page))
+    {
+        AZ_Error("VorbisDecoder", false, "Ogg invalid.");
+        return false;
+    }
+
+    ogg_stream_init(&m_streamState, ogg_page_serialno(&page));
+    if (ogg_stream_pagein(&m_streamState, &page) < 0)
+    {
+        AZ_Error("VorbisDecoder", false, "Error reading first page of Ogg bitstream.");
+        ogg_stream_clear(&m_streamState);
+        return false;
+    }
+
+    int headers = 0;
+    while (headers < 3)
+    {
+        ogg_packet packet;
+        const int result = ogg_stream_packetout(&m_streamState, &packet);
+        if (result == 0)
+        {
+            if (!ReadPage(page))
+            {
+                AZ_Error("VorbisDecoder", false, "End of stream before the Vorbis headers were read.");
+                ogg_stream_clear(&m_streamState);
+                return false;
+            }
+            ogg_stream_pagein(&m_streamState, &page);
+            continue;
+        }
+
+        if (result < 0 || vorbis_synthesis_headerin(&m_info, &m_comment, &packet) < 0)
+        {
+            AZ_Error("VorbisDecoder", false, "This Ogg bitstream does not contain valid Vorbis headers.");
+            ogg_stream_clear(&m_streamState);
+            return false;
+        }
+        ++headers;
+    }
+
+    if (vorbis_synthesis_init(&m_dspState, &m_info) != 0)
+    {
+        AZ_Error("VorbisDecoder", false, "Failed to initialize Vorbis synthesis.");
+        ogg_stream_clear(&m_streamState);
+        return false;
+    }
+    vorbis_block_init(&m_dspState, &m_block);
+
+    //The builder flushes the headers onto their own pages so audio always starts on a fresh page.
+    m_audioStart = GetNextPageOffset();
+    m_open = true;
+    return true;
+}
+
+void VorbisDecoder::Close()
+{
+    if (m_open)
+    {
+        vorbis_block_clear(&m_block);
+        vorbis_dsp_clear(&m_dspState);
+        ogg_stream_clear(&m_streamState);
+        m_open = false;
+    }
+
+    //Keep the structs in a valid state so they can be reused by Open.
+    vorbis_comment_clear(&m_comment);
+    vorbis_info_clear(&m_info);
+    vorbis_info_init(&m_info);
+    vorbis_comment_init(&m_comment);
+    ogg_sync_reset(&m_syncState);
+
+    m_stream = nullptr;
+    m_endOfStream = false;
+}
+
+int VorbisDecoder::Decode(float* const* channels, int maxFrames)
+{
+    if (!m_open)
+    {
+        return -1;
+    }
+
+    int written = 0;
+    while (written < maxFrames)
+    {
+        float** pcm = nullptr;
+        const int available = vorbis_synthesis_pcmout(&m_dspState, &pcm);
+        if (available > 0)
+        {
+            const int frames = AZStd::min(available, maxFrames - written);
+            for (int ch = 0; ch < m_info.channels; ++ch)
+            {
+                memcpy(channels[ch] + written, pcm[ch], frames * sizeof(float));
+            }
+            vorbis_synthesis_read(&m_dspState, frames);
+            written += frames;
+            continue;
+        }
+
+        ogg_packet packet;
+        if (!ReadPacket(packet))
+        {
+            m_endOfStream = true;
+            break;
+        }
+
+        if (vorbis_synthesis(&m_block, &packet) == 0)
+        {
+            vorbis_synthesis_blockin(&m_dspState, &m_block);
+        }
+    }
+
+    return written;
+}
+
+bool VorbisDecoder::Rewind()
+{
+    if (!m_open)
+    {
+        return false;
+    }
+
+    m_stream->Seek(static_cast<AZ::IO::OffsetType>(m_audioStart), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    ogg_sync_reset(&m_syncState);
+    ogg_stream_reset(&m_streamState);
+    vorbis_synthesis_restart(&m_dspState);
+
+    m_endOfStream = false;
+    return true;
+}
+
+bool VorbisDecoder::SeekToPage(AZ::u64 pageOffset, AZ::u64 frame)
+{
+    if (!m_open)
+    {
+        return false;
+    }
+
+    m_stream->Seek(static_cast<AZ::IO::OffsetType>(m_payloadStart + pageOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    ogg_sync_reset(&m_syncState);
+    ogg_stream_reset(&m_streamState);
+    vorbis_synthesis_restart(&m_dspState);
+    m_endOfStream = false;
+
+    //Position of the first pending frame, unknown until a packet carries a granule position.
+    AZ::s64 position = -1;
+    while (true)
+    {
+        float** pcm = nullptr;
+        const int available = vorbis_synthesis_pcmout(&m_dspState, &pcm);
+        if (position >= 0 && available > 0)
+        {
+            if (position + available > static_cast<AZ::s64>(frame))
+            {
+                vorbis_synthesis_read(&m_dspState, static_cast<int>(frame - position));
+                return true;
+            }
+            vorbis_synthesis_read(&m_dspState, available);
+            position += available;
+            continue;
+        }
+
+        ogg_packet packet;
+        if (!ReadPacket(packet))
+        {
+            m_endOfStream = true;
+            return position == static_cast<AZ::s64>(frame);
+        }
+
+        //Header packets at the start of a chained part don't decode and their granule position isn't a frame.
+        const bool audio = vorbis_synthesis(&m_block, &packet) == 0;
+        if (audio)
+        {
+            vorbis_synthesis_blockin(&m_dspState, &m_block);
+        }
+
+        if (position < 0 && audio && packet.granulepos >= 0)
+        {
+            //The granule position is where the pending output ends.
+            position = packet.granulepos - vorbis_synthesis_pcmout(&m_dspState, nullptr);
+            if (position > static_cast<AZ::s64>(frame))
+            {
+                AZ_Error("VorbisDecoder", false, "Seek page starts after the requested frame.");
+                return false;
+            }
+        }
+        else if (position < 0)
+        {
+            //Nothing before the first granule position can be placed, drop it.
+            vorbis_synthesis_read(&m_dspState, vorbis_synthesis_pcmout(&m_dspState, nullptr));
+        }
+    }
+}
+
+bool VorbisDecoder::ReadPage(ogg_page& page)
+{
+    while (true)
+    {
+        const int result = ogg_sync_pageout(&m_syncState, &page);
+        if (result == 1)
+        {
+            return true;
+        }
+        if (result < 0)
+        {
+            //Skipped some garbage, libogg will find the next capture pattern.
+            continue;
+        }
+
+        const AZ::u64 position = m_stream->GetCurPos();
+        if (position >= m_payloadEnd)
+        {
+            return false;
+        }
+
+        //Read straight into libogg's buffer, no intermediate copy.
+        const size_t toRead = static_cast<size_t>(AZStd::min<AZ::u64>(ReadChunkSize, m_payloadEnd - position));
+        char* buffer = ogg_sync_buffer(&m_syncState, static_cast<long>(toRead));
+        const size_t bytesRead = m_stream->Read(toRead, buffer);
+        ogg_sync_wrote(&m_syncState, static_cast<long>(bytesRead));
+        if (bytesRead == 0)
+        {
+            return false;
+        }
+    }
+}
+
+bool VorbisDecoder::ReadPacket(ogg_packet& packet)
+{
+    while (true)
+    {
+        const int result = ogg_stream_packetout(&m_streamState, &packet);
+        if (result == 1)
+        {
+            return true;
+        }
+        if (result < 0)
+        {
+            //Hole in the data, libogg has already resynced.
+            continue;
+        }
+
+        ogg_page page;
+        if (!ReadPage(page))
+        {
+            return false;
+        }
+
+        //Long sounds are built in parts, each its own chained stream with a copy of the headers.
+        //Every part shares the first one's setup and carries absolute granule positions, so only the serial and the overlap change.
+        if (ogg_page_serialno(&page) != m_streamState.serialno)
+        {
+            ogg_stream_reset_serialno(&m_streamState, ogg_page_serialno(&page));
+            vorbis_synthesis_restart(&m_dspState);
+        }
+        ogg_stream_pagein(&m_streamState, &page);
+    }
+}
+
+AZ::u64 VorbisDecoder::GetNextPageOffset() const
+{
+    //Bytes handed to libogg but not yet returned as pages.
+    const AZ::u64 buffered = static_cast<AZ::u64>(m_syncState.fill - m_syncState.returned);
+    return m_stream->GetCurPos() - buffered;
+}
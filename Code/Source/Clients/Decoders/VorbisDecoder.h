@@ -0,0 +1,68 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "SoundDecoder.h"
+
+#include <vorbis/codec.h>
+
+namespace Sune
+{
+    //Incremental Ogg Vorbis decoder, pulls pages from a stream on demand
+    //so only a few KB of compressed data is ever buffered.
+    //Follows the chained parts the builder splits long sounds into as if they were one stream.
+    class VorbisDecoder
+        : public SoundDecoder
+    {
+    public:
+        //Most of the payload read from the stream at once.
+        static constexpr size_t ReadChunkSize = 8 * 1024;
+
+        VorbisDecoder();
+        ~VorbisDecoder() override;
+
+        VorbisDecoder(const VorbisDecoder&) = delete;
+        VorbisDecoder& operator=(const VorbisDecoder&) = delete;
+
+        //Reads the Vorbis headers starting at the streams current position.
+        bool Open(AZ::IO::GenericStream* stream, AZ::u64 payloadSize) override;
+        void Close() override;
+
+        int Decode(float* const* channels, int maxFrames) override;
+
+        //Moves back to the first audio page.
+        bool Rewind() override;
+
+        //The page's granule position must be at or before frame.
+        bool SeekToPage(AZ::u64 pageOffset, AZ::u64 frame) override;
+
+        bool IsOpen() const override { return m_open; }
+        bool IsEndOfStream() const override { return m_endOfStream; }
+        int GetChannels() const override { return m_info.channels; }
+        int GetSampleRate() const override { return static_cast<int>(m_info.rate); }
+
+    private:
+        bool ReadPage(ogg_page& page);
+        bool ReadPacket(ogg_packet& packet);
+        AZ::u64 GetNextPageOffset() const;
+
+        AZ::IO::GenericStream* m_stream = nullptr;
+        AZ::u64 m_payloadStart = 0;
+        AZ::u64 m_payloadEnd = 0;
+        AZ::u64 m_audioStart = 0;
+
+        ogg_sync_state m_syncState;
+        ogg_stream_state m_streamState;
+        vorbis_info m_info;
+        vorbis_comment m_comment;
+        vorbis_dsp_state m_dspState;
+        vorbis_block m_block;
+
+        bool m_open = false;
+        bool m_endOfStream = false;
+    };
+}
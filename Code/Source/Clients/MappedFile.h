@@ -0,0 +1,43 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace Sune
+{
+    //Copy on write mapping of part of a file, pages are shared with the OS file cache until written to.
+    //Implemented per platform.
+    class MappedFile
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedFile, AZ::SystemAllocator);
+
+        //Maps size bytes at offset, returns null if the file can't be mapped.
+        static AZStd::unique_ptr<MappedFile> Open(const char* path, AZ::u64 offset, AZ::u64 size);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        void* GetData() const { return m_data; }
+        AZ::u64 GetSize() const { return m_size; }
+
+    private:
+        MappedFile() = default;
+
+        //The view starts at the mapping granularity boundary at or before the requested offset.
+        void* m_view = nullptr;
+        AZ::u64 m_viewSize = 0;
+
+        void* m_data = nullptr;
+        AZ::u64 m_size = 0;
+    };
+}
@@ -0,0 +1,251 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "CompactSoundSource.h"
+
+#include "Clients/Adpcm.h"
+#include "Clients/SampleConversion.h"
+
+#include <AzCore/std/algorithm.h>
+
+using namespace Sune;
+
+CompactSoundSource::CompactSoundSource(const SoundDataAsset& asset)
+    : m_asset(asset)
+    , m_samples(asset->m_sampleData)
+    , m_precision(asset->m_precision)
+    , m_adpcm(asset->m_importFormat == AudioImportFormat::Adpcm)
+    , m_channels(asset->m_channels)
+    , m_sampleRate(asset->m_sampleRate)
+    , m_frames(asset->m_totalSamples / asset->m_channels)
+{
+    m_mixBuffer.resize(MixFrames);
+    if (m_adpcm)
+    {
+        m_blockSamples.resize(MaxDecodedBlocks * m_channels * Adpcm::BlockFrames);
+    }
+}
+
+void CompactSoundSource::Start(size_t frame, int loopCount)
+{
+    PushCommand({CommandType::Restart, frame, loopCount});
+}
+
+void CompactSoundSource::AddVoice(size_t frame, int loopCount)
+{
+    PushCommand({CommandType::Add, frame, loopCount});
+}
+
+void CompactSoundSource::Stop()
+{
+    PushCommand({CommandType::Stop});
+}
+
+void CompactSoundSource::PushCommand(const Command& command)
+{
+    const AZ::u32 write = m_commandWrite.load(AZStd::memory_order_relaxed);
+    if (write - m_commandRead.load(AZStd::memory_order_acquire) >= MaxCommands)
+    {
+        AZ_Warning("CompactSoundSource", false, "Too many playback requests queued, dropping one.");
+        return;
+    }
+
+    m_commands[write % MaxCommands] = command;
+    m_commandWrite.store(write + 1, AZStd::memory_order_release);
+}
+
+void CompactSoundSource::ApplyCommands()
+{
+    const AZ::u32 write = m_commandWrite.load(AZStd::memory_order_acquire);
+    AZ::u32 read = m_commandRead.load(AZStd::memory_order_relaxed);
+    for (; read != write; ++read)
+    {
+        const Command& command = m_commands[read % MaxCommands];
+        if (command.m_type != CommandType::Add)
+        {
+            m_voices.clear();
+        }
+
+        if (command.m_type != CommandType::Stop && command.m_frame < m_frames)
+        {
+            if (m_voices.size() == MaxVoices)
+            {
+                //Steal the oldest voice.
+                m_voices.erase(m_voices.begin());
+            }
+            m_voices.push_back({command.m_frame, command.m_loopCount});
+            m_cursor.store(command.m_frame, AZStd::memory_order_relaxed);
+        }
+    }
+    m_commandRead.store(read, AZStd::memory_order_release);
+}
+
+int CompactSoundSource::Render(float* const* channels, int frames)
+{
+    ApplyCommands();
+
+    //Everything before this is decoded, fully decoded assets always have every frame.
+    const AZ::u64 availableFrames = AZStd::min(m_asset->m_decodedFrames.load(AZStd::memory_order_acquire), m_frames);
+
+    //The first voice converts straight into the output, the rest mix on top of it.
+    int written = 0;
+    bool mix = false;
+    for (size_t i = 0; i < m_voices.size();)
+    {
+        const int produced = RenderVoice(m_voices[i], channels, frames, mix, availableFrames);
+        if (!mix)
+        {
+            for (int ch = 0; ch < m_channels; ++ch)
+            {
+                AZStd::fill(channels[ch] + produced, channels[ch] + frames, 0.0f);
+            }
+            written = frames;
+            mix = true;
+        }
+
+        //A voice waiting on the tail decode keeps its place.
+        if (produced < frames && IsVoiceFinished(m_voices[i]))
+        {
+            m_voices.erase(m_voices.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    if (!m_voices.empty())
+    {
+        m_cursor.store(m_voices.back().m_frame, AZStd::memory_order_relaxed);
+    }
+    m_activeVoices.store(static_cast<int>(m_voices.size()), AZStd::memory_order_release);
+    return written;
+}
+
+bool CompactSoundSource::IsVoiceFinished(const Voice& voice) const
+{
+    return voice.m_frame >= m_frames && voice.m_loopsRemaining == 0;
+}
+
+int CompactSoundSource::RenderVoice(Voice& voice, float* const* channels, int frames, bool mix, AZ::u64 availableFrames)
+{
+    int produced = 0;
+    while (produced < frames)
+    {
+        if (voice.m_frame >= m_frames)
+        {
+            if (voice.m_loopsRemaining == 0)
+            {
+                break;
+            }
+            if (voice.m_loopsRemaining > 0)
+            {
+                --voice.m_loopsRemaining;
+            }
+            voice.m_frame = 0;
+        }
+
+        if (voice.m_frame >= availableFrames)
+        {
+            //Starving, the rest of this quantum stays silent.
+            break;
+        }
+
+        int count = static_cast<int>(AZStd::min<AZ::u64>(frames - produced, availableFrames - voice.m_frame));
+        if (mix)
+        {
+            count = AZStd::min(count, MixFrames);
+        }
+
+        const float* block = nullptr;
+        const AZ::u64 blockOffset = voice.m_frame % Adpcm::BlockFrames;
+        if (m_adpcm)
+        {
+            //Never past the end of the block, the next one may not be decoded.
+            count = AZStd::min(count, static_cast<int>(Adpcm::BlockFrames - blockOffset));
+            block = GetDecodedBlock(voice.m_frame / Adpcm::BlockFrames);
+        }
+
+        for (int ch = 0; ch < m_channels; ++ch)
+        {
+            const size_t offset = ch * m_frames + voice.m_frame;
+            float* destination = channels[ch] + produced;
+            const float* source = nullptr;
+            if (m_adpcm)
+            {
+                source = block + ch * Adpcm::BlockFrames + blockOffset;
+            }
+            else if (m_precision == SamplePrecision::Float32)
+            {
+                source = static_cast<const float*>(m_samples) + offset;
+            }
+            else
+            {
+                float* unpacked = mix ? m_mixBuffer.data() : destination;
+                UnpackSamples(m_precision, static_cast<const AZ::u16*>(m_samples) + offset, unpacked, count);
+                source = unpacked;
+            }
+
+            if (mix)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    destination[i] += source[i];
+                }
+            }
+            else if (source != destination)
+            {
+                AZStd::copy(source, source + count, destination);
+            }
+        }
+
+        voice.m_frame += count;
+        produced += count;
+    }
+    return produced;
+}
+
+const float* CompactSoundSource::GetDecodedBlock(AZ::u64 block)
+{
+    const size_t blockSamples = m_channels * Adpcm::BlockFrames;
+    ++m_blockUses;
+
+    //Voices started together share their blocks, otherwise the least recently used one is replaced.
+    size_t slot = 0;
+    for (size_t i = 0; i < m_decodedBlocks.size(); ++i)
+    {
+        if (m_decodedBlocks[i].m_block == block)
+        {
+            m_decodedBlocks[i].m_lastUse = m_blockUses;
+            return m_blockSamples.data() + i * blockSamples;
+        }
+        if (m_decodedBlocks[i].m_lastUse < m_decodedBlocks[slot].m_lastUse)
+        {
+            slot = i;
+        }
+    }
+
+    float* decoded = m_blockSamples.data() + slot * blockSamples;
+    const AZ::u8* encoded = static_cast<const AZ::u8*>(m_samples) + block * m_channels * Adpcm::BlockSize;
+    for (int ch = 0; ch < m_channels; ++ch)
+    {
+        Adpcm::DecodeBlock(encoded + ch * Adpcm::BlockSize, decoded + ch * Adpcm::BlockFrames);
+    }
+    m_decodedBlocks[slot] = {block, m_blockUses};
+    return decoded;
+}
+
+bool CompactSoundSource::IsFinished() const
+{
+    //A queued request counts as playing until the audio thread picks it up.
+    return m_activeVoices.load(AZStd::memory_order_acquire) == 0
+        && m_commandRead.load(AZStd::memory_order_acquire) == m_commandWrite.load(AZStd::memory_order_acquire);
+}
+
+size_t CompactSoundSource::GetCursor() const
+{
+    return static_cast<size_t>(m_cursor.load(AZStd::memory_order_relaxed));
+}
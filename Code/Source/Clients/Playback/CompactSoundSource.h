@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "SoundSource.h"
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace Sune
+{
+    //Plays Int16 or Half resident samples, converting to float one quantum at a time.
+    //ADPCM assets are decoded a block at a time, a block is one render quantum so a voice normally decodes one per quantum.
+    //Also plays float samples whose tail is still decoding, voices wait at the decoded frontier instead of reading past it.
+    //Supports overlapping voices like SampledAudioNode so SFX can still be played multiple times.
+    class CompactSoundSource
+        : public SoundSource
+    {
+    public:
+        static constexpr int MaxVoices = 8;
+        //Frames converted at once when mixing more than one voice.
+        static constexpr int MixFrames = 256;
+        //Decoded ADPCM blocks kept around, enough for every voice to be part way through one while starting the next.
+        static constexpr int MaxDecodedBlocks = MaxVoices * 2;
+
+        explicit CompactSoundSource(const SoundDataAsset& asset);
+        ~CompactSoundSource() override = default;
+
+        //SoundSource
+        int GetChannelCount() const override { return m_channels; }
+        float GetSampleRate() const override { return static_cast<float>(m_sampleRate); }
+        void Start(size_t frame, int loopCount) override;
+        void AddVoice(size_t frame, int loopCount) override;
+        void Stop() override;
+        int Render(float* const* channels, int frames) override;
+        bool IsFinished() const override;
+        size_t GetCursor() const override;
+
+    private:
+        enum class CommandType
+        {
+            Restart,
+            Add,
+            Stop,
+        };
+
+        struct Command
+        {
+            CommandType m_type = CommandType::Stop;
+            AZ::u64 m_frame = 0;
+            int m_loopCount = 0;
+        };
+
+        struct Voice
+        {
+            AZ::u64 m_frame = 0;
+            int m_loopsRemaining = 0;
+        };
+
+        struct DecodedBlock
+        {
+            AZ::u64 m_block = AZStd::numeric_limits<AZ::u64>::max();
+            AZ::u64 m_lastUse = 0;
+        };
+
+        void PushCommand(const Command& command);
+        void ApplyCommands();
+        //Returns the frames the voice produced, less than frames once it ends or reaches availableFrames.
+        int RenderVoice(Voice& voice, float* const* channels, int frames, bool mix, AZ::u64 availableFrames);
+        bool IsVoiceFinished(const Voice& voice) const;
+        //Planar float samples of every channel in the block, decoded if no voice has used it recently.
+        const float* GetDecodedBlock(AZ::u64 block);
+
+        //Keeps the samples alive
+        SoundDataAsset m_asset;
+        const void* m_samples = nullptr;
+        SamplePrecision m_precision = SamplePrecision::Int16;
+        bool m_adpcm = false;
+        int m_channels = 0;
+        int m_sampleRate = 0;
+        AZ::u64 m_frames = 0;
+
+        //Main thread to audio thread
+        static constexpr AZ::u32 MaxCommands = 16;
+        AZStd::array<Command, MaxCommands> m_commands;
+        AZStd::atomic<AZ::u32> m_commandWrite = 0;
+        AZStd::atomic<AZ::u32> m_commandRead = 0;
+
+        //Audio thread only
+        AZStd::fixed_vector<Voice, MaxVoices> m_voices;
+        AZStd::vector<float> m_mixBuffer;
+        AZStd::array<DecodedBlock, MaxDecodedBlocks> m_decodedBlocks;
+        //MaxDecodedBlocks blocks of m_channels * Adpcm::BlockFrames samples
+        AZStd::vector<float> m_blockSamples;
+        AZ::u64 m_blockUses = 0;
+
+        AZStd::atomic<AZ::u64> m_cursor = 0;
+        AZStd::atomic_int m_activeVoices = 0;
+    };
+}
@@ -0,0 +1,34 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "RenderEpochNode.h"
+
+#include "Clients/SampleGraveyard.h"
+
+using namespace Sune;
+
+RenderEpochNode::RenderEpochNode(lab::AudioContext& ac, SampleGraveyard& graveyard)
+    : lab::AudioNode(ac, *desc())
+    , m_graveyard(graveyard)
+{
+    initialize();
+}
+
+RenderEpochNode::~RenderEpochNode()
+{
+    uninitialize();
+}
+
+lab::AudioNodeDescriptor* RenderEpochNode::desc()
+{
+    static lab::AudioNodeDescriptor d {nullptr, nullptr};
+    return &d;
+}
+
+void RenderEpochNode::process(lab::ContextRenderLock& r, int bufferSize)
+{
+    m_graveyard.AdvanceEpoch();
+}
@@ -0,0 +1,36 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <LabSound/core/AudioNode.h>
+
+namespace Sune
+{
+    class SampleGraveyard;
+
+    //Pulled by the context every render quantum, advances the graveyard's epoch.
+    //Registered as an automatic pull node so it runs without being connected to anything.
+    class RenderEpochNode
+        : public lab::AudioNode
+    {
+    public:
+        RenderEpochNode(lab::AudioContext& ac, SampleGraveyard& graveyard);
+        ~RenderEpochNode() override;
+
+        static const char* static_name() { return "SuneRenderEpoch"; }
+        const char* name() const override { return static_name(); }
+        static lab::AudioNodeDescriptor* desc();
+
+        void process(lab::ContextRenderLock& r, int bufferSize) override;
+        void reset(lab::ContextRenderLock& r) override {}
+        double tailTime(lab::ContextRenderLock& r) const override { return 0; }
+        double latencyTime(lab::ContextRenderLock& r) const override { return 0; }
+
+    private:
+        SampleGraveyard& m_graveyard;
+    };
+}
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "ResamplingSoundSource.h"
+
+#include <AzCore/std/algorithm.h>
+
+using namespace Sune;
+
+ResamplingSoundSource::ResamplingSoundSource(std::shared_ptr<SoundSource> source, AZ::u32 outputRate)
+    : m_source(AZStd::move(source))
+    , m_resampler(static_cast<AZ::u32>(m_source->GetSampleRate()), outputRate)
+{
+    AZ_Assert(m_source->GetChannelCount() <= MaxChannels, "Too many channels to resample.");
+    const int channels = AZStd::min(m_source->GetChannelCount(), MaxChannels);
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        m_streams.emplace_back(m_resampler, BlockFrames);
+    }
+    m_input.resize(channels * m_streams[0].GetMaxInputFrames());
+}
+
+void ResamplingSoundSource::Start(size_t frame, int loopCount)
+{
+    m_source->Start(frame, loopCount);
+    m_restartSerial.fetch_add(1, AZStd::memory_order_release);
+}
+
+void ResamplingSoundSource::AddVoice(size_t frame, int loopCount)
+{
+    m_source->AddVoice(frame, loopCount);
+    m_voiceSerial.fetch_add(1, AZStd::memory_order_release);
+}
+
+void ResamplingSoundSource::Stop()
+{
+    m_source->Stop();
+    m_restartSerial.fetch_add(1, AZStd::memory_order_release);
+}
+
+void ResamplingSoundSource::Reset()
+{
+    for (ResamplerStream& stream : m_streams)
+    {
+        stream.Reset();
+    }
+    m_inputFrames = 0;
+    m_outputFrames = 0;
+    m_sourceEnded = false;
+}
+
+int ResamplingSoundSource::Render(float* const* channels, int frames)
+{
+    const AZ::u32 restartSerial = m_restartSerial.load(AZStd::memory_order_acquire);
+    const AZ::u32 voiceSerial = m_voiceSerial.load(AZStd::memory_order_acquire);
+    if (restartSerial != m_seenRestartSerial || (voiceSerial != m_seenVoiceSerial && m_sourceEnded))
+    {
+        //A voice added to a playing source joins the existing history instead.
+        Reset();
+    }
+    m_seenRestartSerial = restartSerial;
+    m_seenVoiceSerial = voiceSerial;
+
+    const size_t maxInput = m_streams[0].GetMaxInputFrames();
+    float* input[MaxChannels];
+    for (size_t ch = 0; ch < m_streams.size(); ++ch)
+    {
+        input[ch] = m_input.data() + ch * maxInput;
+    }
+
+    int written = 0;
+    while (written < frames)
+    {
+        size_t block = static_cast<size_t>(AZStd::min(frames - written, BlockFrames));
+        if (m_sourceEnded)
+        {
+            const AZ::u64 remaining = m_resampler.GetOutputFrames(m_inputFrames) - m_outputFrames;
+            block = static_cast<size_t>(AZStd::min<AZ::u64>(block, remaining));
+            if (block == 0)
+            {
+                break;
+            }
+        }
+
+        const size_t needed = m_streams[0].GetInputFramesNeeded(block);
+        size_t rendered = 0;
+        if (needed > 0 && !m_sourceEnded)
+        {
+            rendered = static_cast<size_t>(AZStd::max(m_source->Render(input, static_cast<int>(needed)), 0));
+            m_inputFrames += rendered;
+            m_sourceEnded = rendered < needed && m_source->IsFinished();
+        }
+
+        //Past the end the kernel reads zeros, the same padding Process uses.
+        const size_t filled = m_sourceEnded ? needed : rendered;
+        for (size_t ch = 0; ch < m_streams.size(); ++ch)
+        {
+            AZStd::fill(input[ch] + rendered, input[ch] + filled, 0.0f);
+            m_streams[ch].Push(input[ch], filled);
+        }
+
+        size_t produced = 0;
+        for (size_t ch = 0; ch < m_streams.size(); ++ch)
+        {
+            produced = m_streams[ch].Pull(channels[ch] + written, block);
+        }
+        written += static_cast<int>(produced);
+        m_outputFrames += produced;
+
+        if (produced < block)
+        {
+            //Starving, try again next quantum.
+            break;
+        }
+    }
+    return written;
+}
+
+bool ResamplingSoundSource::IsFinished() const
+{
+    return m_sourceEnded && m_outputFrames >= m_resampler.GetOutputFrames(m_inputFrames);
+}
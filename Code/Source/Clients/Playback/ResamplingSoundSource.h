@@ -0,0 +1,62 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "SoundSource.h"
+#include "Clients/Resampler.h"
+
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace Sune
+{
+    //Converts another source to the context rate while rendering, SampledAudioNode does the same for assets played from a bus.
+    //The rate and cursor stay the inner source's so positions are still in the asset's frames.
+    class ResamplingSoundSource
+        : public SoundSource
+    {
+    public:
+        //Output frames converted at once, render quanta are smaller than this.
+        static constexpr int BlockFrames = 256;
+        static constexpr int MaxChannels = 8;
+
+        ResamplingSoundSource(std::shared_ptr<SoundSource> source, AZ::u32 outputRate);
+        ~ResamplingSoundSource() override = default;
+
+        //SoundSource
+        int GetChannelCount() const override { return m_source->GetChannelCount(); }
+        float GetSampleRate() const override { return m_source->GetSampleRate(); }
+        void Start(size_t frame, int loopCount) override;
+        void AddVoice(size_t frame, int loopCount) override;
+        void Stop() override;
+        int Render(float* const* channels, int frames) override;
+        bool IsFinished() const override;
+        size_t GetCursor() const override { return m_source->GetCursor(); }
+
+    private:
+        void Reset();
+
+        std::shared_ptr<SoundSource> m_source;
+        PolyphaseResampler m_resampler;
+
+        //Main thread to audio thread, the audio thread drops the filter history when a restart is seen.
+        AZStd::atomic<AZ::u32> m_restartSerial = 0;
+        AZStd::atomic<AZ::u32> m_voiceSerial = 0;
+
+        //Audio thread only
+        AZ::u32 m_seenRestartSerial = 0;
+        AZ::u32 m_seenVoiceSerial = 0;
+        AZStd::fixed_vector<ResamplerStream, MaxChannels> m_streams;
+        //Planar input of GetMaxInputFrames per channel
+        AZStd::vector<float> m_input;
+        //Inner frames rendered and outputs produced since the last reset, the output ends once it covers the input.
+        AZ::u64 m_inputFrames = 0;
+        AZ::u64 m_outputFrames = 0;
+        bool m_sourceEnded = false;
+    };
+}
@@ -0,0 +1,59 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundSource.h"
+
+#include "CompactSoundSource.h"
+#include "ResamplingSoundSource.h"
+#include "StreamingSoundSource.h"
+
+using namespace Sune;
+
+bool Sune::NeedsSoundSource(const SoundAsset& asset)
+{
+    if (asset.m_loadMethod == AudioLoadMethod::DecodeOnDemand)
+    {
+        return true;
+    }
+
+    //LabSound can only play float samples that are fully decoded from a bus.
+    return asset.m_sampleData != nullptr && (asset.m_importFormat == AudioImportFormat::Adpcm
+        || asset.m_precision != SamplePrecision::Float32 || !asset.IsFullyDecoded());
+}
+
+namespace
+{
+    std::shared_ptr<SoundSource> CreateNativeRateSource(const SoundDataAsset& asset)
+    {
+        if (!NeedsSoundSource(*asset.Get()))
+        {
+            return nullptr;
+        }
+
+        if (asset->m_loadMethod == AudioLoadMethod::DecodeOnDemand)
+        {
+            return StreamingSoundSource::Create(*asset.Get());
+        }
+        return std::make_shared<CompactSoundSource>(asset);
+    }
+}
+
+std::shared_ptr<SoundSource> Sune::CreateSoundSource(const SoundDataAsset& asset, float outputRate)
+{
+    if (!asset.IsReady())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<SoundSource> source = CreateNativeRateSource(asset);
+    const AZ::u32 rate = static_cast<AZ::u32>(outputRate);
+    if (source && rate > 0 && static_cast<AZ::u32>(source->GetSampleRate()) != rate)
+    {
+        //Sources copy frames straight to the output, unlike SampledAudioNode which converts from the bus rate.
+        return std::make_shared<ResamplingSoundSource>(AZStd::move(source), rate);
+    }
+    return source;
+}
@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <memory>
+
+#include <AzCore/base.h>
+
+#include "Sune/SoundAsset.h"
+
+namespace Sune
+{
+    //Audio that is produced while rendering instead of being fully decoded into a lab::AudioBus.
+    //Start is called from the main thread, Render and IsFinished from the audio thread.
+    class SoundSource
+    {
+    public:
+        virtual ~SoundSource() = default;
+
+        virtual int GetChannelCount() const = 0;
+        virtual float GetSampleRate() const = 0;
+
+        //Positions the source at frame, loopCount follows SampledAudioNode (-1 loops forever).
+        virtual void Start(size_t frame, int loopCount) = 0;
+
+        //Plays another voice over the current ones, sources with a single read position just restart.
+        virtual void AddVoice(size_t frame, int loopCount) { Start(frame, loopCount); }
+
+        //Drops every voice, the next Start or AddVoice plays from scratch.
+        virtual void Stop() {}
+
+        //Writes up to frames planar frames, returns how many were written.
+        //Writing less than asked without being finished means the source is starving.
+        virtual int Render(float* const* channels, int frames) = 0;
+        virtual bool IsFinished() const = 0;
+
+        //Frame the next Render call will produce.
+        virtual size_t GetCursor() const = 0;
+    };
+
+    //True if the asset can't be played from its lab::AudioBus right now.
+    //Fast start assets only need a source until their tail is decoded.
+    bool NeedsSoundSource(const SoundAsset& asset);
+
+    //Returns null when the asset is played from its lab::AudioBus.
+    //Sources at a different rate to outputRate are resampled while rendering.
+    std::shared_ptr<SoundSource> CreateSoundSource(const SoundDataAsset& asset, float outputRate);
+}
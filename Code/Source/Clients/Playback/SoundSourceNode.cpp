@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundSourceNode.h"
+
+#include "SoundSource.h"
+
+#include <AzCore/Debug/Trace.h>
+
+#include <LabSound/core/AudioBus.h>
+#include <LabSound/core/AudioContext.h>
+#include <LabSound/core/AudioNodeOutput.h>
+
+using namespace Sune;
+
+SoundSourceNode::SoundSourceNode(lab::AudioContext& ac)
+    : lab::AudioScheduledSourceNode(ac, *desc())
+{
+    //Mono until a source is set.
+    addOutput(std::unique_ptr<lab::AudioNodeOutput>(new lab::AudioNodeOutput(this, 1)));
+    initialize();
+}
+
+SoundSourceNode::~SoundSourceNode()
+{
+    uninitialize();
+}
+
+lab::AudioNodeDescriptor* SoundSourceNode::desc()
+{
+    static lab::AudioNodeDescriptor d {nullptr, nullptr};
+    return &d;
+}
+
+void SoundSourceNode::SetSource(lab::AudioContext& ac, std::shared_ptr<SoundSource> source)
+{
+    if (source && (source->GetChannelCount() < 1 || source->GetChannelCount() > MaxChannels))
+    {
+        AZ_Error("SoundSourceNode", false, "Sources with %d channels aren't supported.", source->GetChannelCount());
+        source = nullptr;
+    }
+
+    lab::ContextRenderLock r(&ac, "SoundSourceNode::SetSource");
+    m_source = std::move(source);
+    output(0)->setNumberOfChannels(r, m_source ? m_source->GetChannelCount() : 1);
+}
+
+void SoundSourceNode::process(lab::ContextRenderLock& r, int bufferSize)
+{
+    lab::AudioBus* outputBus = output(0)->bus(r);
+    outputBus->zero();
+
+    const int offset = _scheduler._renderOffset;
+    const int frames = _scheduler._renderLength;
+    if (!isInitialized() || !m_source || frames <= 0
+        || outputBus->numberOfChannels() != m_source->GetChannelCount())
+    {
+        return;
+    }
+
+    float* destinations[MaxChannels];
+    for (int ch = 0; ch < m_source->GetChannelCount(); ++ch)
+    {
+        destinations[ch] = outputBus->channel(ch)->mutableData() + offset;
+    }
+
+    //Anything the source couldn't provide stays silent.
+    m_source->Render(destinations, frames);
+    outputBus->clearSilentFlag();
+
+    if (m_source->IsFinished())
+    {
+        _scheduler.finish(r);
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <memory>
+
+#include <LabSound/core/AudioScheduledSourceNode.h>
+
+namespace Sune
+{
+    class SoundSource;
+
+    //LabSound source node that pulls each render quantum from a SoundSource.
+    class SoundSourceNode
+        : public lab::AudioScheduledSourceNode
+    {
+    public:
+        explicit SoundSourceNode(lab::AudioContext& ac);
+        ~SoundSourceNode() override;
+
+        static const char* static_name() { return "SuneSoundSource"; }
+        const char* name() const override { return static_name(); }
+        static lab::AudioNodeDescriptor* desc();
+
+        //Takes the render lock, output channels follow the source.
+        void SetSource(lab::AudioContext& ac, std::shared_ptr<SoundSource> source);
+        std::shared_ptr<SoundSource> GetSource() const { return m_source; }
+
+        void process(lab::ContextRenderLock& r, int bufferSize) override;
+        void reset(lab::ContextRenderLock& r) override {}
+        double tailTime(lab::ContextRenderLock& r) const override { return 0; }
+        double latencyTime(lab::ContextRenderLock& r) const override { return 0; }
+
+        static constexpr int MaxChannels = 8;
+
+    private:
+        std::shared_ptr<SoundSource> m_source;
+    };
+}
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundStreamer.h"
+
+#include "StreamingSoundSource.h"
+
+#include <AzCore/std/chrono/chrono.h>
+
+using namespace Sune;
+
+SoundStreamer::SoundStreamer()
+{
+    if (SoundStreamerInterface::Get() == nullptr)
+    {
+        SoundStreamerInterface::Register(this);
+    }
+
+    AZStd::thread_desc desc;
+    desc.m_name = "Sune Streamer";
+    m_thread = AZStd::thread(desc, [this]()
+    {
+        Run();
+    });
+}
+
+SoundStreamer::~SoundStreamer()
+{
+    m_running = false;
+    Wake();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    if (SoundStreamerInterface::Get() == this)
+    {
+        SoundStreamerInterface::Unregister(this);
+    }
+}
+
+void SoundStreamer::AddSource(const std::shared_ptr<StreamingSoundSource>& source)
+{
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_sources.push_back(source);
+    }
+    Wake();
+}
+
+void SoundStreamer::Wake()
+{
+    //No lock here so the audio thread can call it, worst case the streamer picks it up on its next timeout.
+    m_wakeRequested = true;
+    m_wakeCondition.notify_one();
+}
+
+void SoundStreamer::Run()
+{
+    AZStd::vector<std::shared_ptr<StreamingSoundSource>> sources;
+    while (m_running)
+    {
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            sources.clear();
+            for (auto it = m_sources.begin(); it != m_sources.end();)
+            {
+                if (auto source = it->lock())
+                {
+                    sources.push_back(AZStd::move(source));
+                    ++it;
+                }
+                else
+                {
+                    it = m_sources.erase(it);
+                }
+            }
+        }
+
+        bool busy = false;
+        for (auto& source : sources)
+        {
+            busy |= source->Service();
+        }
+        //Don't keep sources alive while sleeping.
+        sources.clear();
+
+        if (!busy)
+        {
+            AZStd::unique_lock lock(m_mutex);
+            m_wakeCondition.wait_for(lock, AZStd::chrono::milliseconds(5), [this]()
+            {
+                return m_wakeRequested.load() || !m_running.load();
+            });
+        }
+        m_wakeRequested = false;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <memory>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace Sune
+{
+    class StreamingSoundSource;
+
+    //Owns the thread that keeps every streaming source's ring buffer topped up.
+    class SoundStreamer
+    {
+    public:
+        AZ_RTTI(SoundStreamer, "{4E0B3C2A-7F1D-4B8E-9A56-2D8C1E7F3B90}");
+        AZ_CLASS_ALLOCATOR(SoundStreamer, AZ::SystemAllocator);
+
+        SoundStreamer();
+        virtual ~SoundStreamer();
+
+        void AddSource(const std::shared_ptr<StreamingSoundSource>& source);
+
+        //Safe to call from the audio thread, never blocks.
+        void Wake();
+
+    private:
+        void Run();
+
+        AZStd::thread m_thread;
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_wakeCondition;
+        AZStd::atomic_bool m_wakeRequested = false;
+        AZStd::atomic_bool m_running = true;
+
+        AZStd::vector<std::weak_ptr<StreamingSoundSource>> m_sources;
+    };
+
+    using SoundStreamerInterface = AZ::Interface<SoundStreamer>;
+}
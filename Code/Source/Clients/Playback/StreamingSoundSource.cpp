@@ -0,0 +1,288 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "StreamingSoundSource.h"
+
+#include "SoundStreamer.h"
+
+#include <AzCore/std/algorithm.h>
+#include <cstring>
+
+using namespace Sune;
+
+std::shared_ptr<StreamingSoundSource> StreamingSoundSource::Create(const SoundAsset& asset)
+{
+    SoundStreamer* streamer = SoundStreamerInterface::Get();
+    if (streamer == nullptr)
+    {
+        AZ_Error("StreamingSoundSource", false, "Sound streamer isn't running.");
+        return nullptr;
+    }
+
+    if (asset.m_streamPath.empty() || asset.m_channels <= 0)
+    {
+        AZ_Error("StreamingSoundSource", false, "Asset doesn't have anything to stream.");
+        return nullptr;
+    }
+
+    auto source = std::make_shared<StreamingSoundSource>(asset, streamer);
+    streamer->AddSource(source);
+    return source;
+}
+
+StreamingSoundSource::StreamingSoundSource(const SoundAsset& asset, SoundStreamer* streamer)
+    : m_streamer(streamer)
+    , m_path(asset.m_streamPath)
+    , m_payloadOffset(asset.m_payloadOffset)
+    , m_payloadSize(asset.m_payloadSize)
+    , m_format(asset.m_importFormat)
+    , m_channels(asset.m_channels)
+    , m_sampleRate(asset.m_sampleRate)
+    , m_totalFrames(asset.m_totalSamples / asset.m_channels)
+    , m_seekTable(asset.m_seekTable)
+{
+    m_ring.resize(RingFrames * m_channels, 0.0f);
+    m_scratch.resize(static_cast<size_t>(ServiceFrames) * m_channels);
+    m_channelPointers.resize(m_channels);
+}
+
+void StreamingSoundSource::Start(size_t frame, int loopCount)
+{
+    //A source primed from the start that hasn't been played yet can be used as is.
+    const bool untouched = m_requestSerial.load() == m_readerSerial.load()
+        && m_cursorStart.load() == 0
+        && m_renderedFrames.load() == 0;
+    if (untouched && frame == 0 && loopCount == m_pendingLoops.load())
+    {
+        return;
+    }
+
+    m_pendingFrame.store(frame, AZStd::memory_order_relaxed);
+    m_pendingLoops.store(loopCount, AZStd::memory_order_relaxed);
+    m_requestSerial.fetch_add(1, AZStd::memory_order_release);
+    m_streamer->Wake();
+}
+
+int StreamingSoundSource::Render(float* const* channels, int frames)
+{
+    const AZ::u32 requested = m_requestSerial.load(AZStd::memory_order_acquire);
+    if (m_readerSerial.load(AZStd::memory_order_relaxed) != requested)
+    {
+        //Stop reading the old data, the streamer flushes the ring once it sees this.
+        m_cursorStart.store(m_pendingFrame.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        m_renderedFrames.store(0, AZStd::memory_order_relaxed);
+        m_readerSerial.store(requested, AZStd::memory_order_release);
+        m_streamer->Wake();
+        return 0;
+    }
+
+    if (m_publishedSerial.load(AZStd::memory_order_acquire) != requested)
+    {
+        return 0;
+    }
+
+    const AZ::u64 read = m_readPos.load(AZStd::memory_order_relaxed);
+    const AZ::u64 write = m_writePos.load(AZStd::memory_order_acquire);
+    const int count = static_cast<int>(AZStd::min<AZ::u64>(frames, write - read));
+    const AZ::u64 ringIndex = read % RingFrames;
+    const int firstPart = static_cast<int>(AZStd::min<AZ::u64>(count, RingFrames - ringIndex));
+
+    for (int ch = 0; ch < m_channels; ++ch)
+    {
+        const float* ring = m_ring.data() + ch * RingFrames;
+        memcpy(channels[ch], ring + ringIndex, firstPart * sizeof(float));
+        memcpy(channels[ch] + firstPart, ring, (count - firstPart) * sizeof(float));
+    }
+
+    m_readPos.store(read + count, AZStd::memory_order_release);
+    m_renderedFrames.fetch_add(count, AZStd::memory_order_relaxed);
+
+    if (count < frames && !m_decodeEnded.load(AZStd::memory_order_relaxed))
+    {
+        //Starving, give the streamer a nudge.
+        m_streamer->Wake();
+    }
+    return count;
+}
+
+bool StreamingSoundSource::IsFinished() const
+{
+    if (m_failed)
+    {
+        return true;
+    }
+
+    const AZ::u32 requested = m_requestSerial.load(AZStd::memory_order_acquire);
+    if (m_readerSerial.load() != requested || m_publishedSerial.load(AZStd::memory_order_acquire) != requested)
+    {
+        return false;
+    }
+
+    return m_decodeEnded.load(AZStd::memory_order_acquire)
+        && m_readPos.load() == m_writePos.load(AZStd::memory_order_acquire);
+}
+
+size_t StreamingSoundSource::GetCursor() const
+{
+    const AZ::u64 position = m_cursorStart.load() + m_renderedFrames.load();
+    //Loops always restart from the beginning of the asset.
+    return static_cast<size_t>(m_totalFrames > 0 ? position % m_totalFrames : position);
+}
+
+bool StreamingSoundSource::Service()
+{
+    if (m_failed)
+    {
+        return false;
+    }
+
+    if ((!m_decoder || !m_decoder->IsOpen()) && !OpenDecoder())
+    {
+        m_failed = true;
+        return false;
+    }
+
+    const AZ::u32 requested = m_requestSerial.load(AZStd::memory_order_acquire);
+    if (requested != m_workerSerial)
+    {
+        //The audio thread has to let go of the old data before we can flush it.
+        if (m_readerSerial.load(AZStd::memory_order_acquire) != requested)
+        {
+            return false;
+        }
+
+        m_loopsRemaining = m_pendingLoops.load(AZStd::memory_order_relaxed);
+        m_readPos.store(m_writePos.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        m_decodeEnded = false;
+        if (!SeekDecoder(m_pendingFrame.load(AZStd::memory_order_relaxed)))
+        {
+            m_failed = true;
+        }
+
+        m_workerSerial = requested;
+        m_publishedSerial.store(requested, AZStd::memory_order_release);
+    }
+
+    if (m_failed || m_decodeEnded.load(AZStd::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    const AZ::u64 write = m_writePos.load(AZStd::memory_order_relaxed);
+    const AZ::u64 read = m_readPos.load(AZStd::memory_order_acquire);
+    const AZ::u64 freeFrames = RingFrames - (write - read);
+    if (freeFrames < ServiceFrames / 4)
+    {
+        return false;
+    }
+
+    //Decode straight into the ring, up to the wrap point.
+    const AZ::u64 ringIndex = write % RingFrames;
+    const int frames = static_cast<int>(AZStd::min(AZStd::min(freeFrames, RingFrames - ringIndex), static_cast<AZ::u64>(ServiceFrames)));
+    for (int ch = 0; ch < m_channels; ++ch)
+    {
+        m_channelPointers[ch] = m_ring.data() + ch * RingFrames + ringIndex;
+    }
+
+    const int decoded = m_decoder->Decode(m_channelPointers.data(), frames);
+    if (decoded < 0)
+    {
+        m_failed = true;
+        return false;
+    }
+
+    if (decoded > 0)
+    {
+        m_writePos.store(write + decoded, AZStd::memory_order_release);
+    }
+
+    if (m_decoder->IsEndOfStream())
+    {
+        if (m_loopsRemaining != 0)
+        {
+            m_decoder->Rewind();
+            if (m_loopsRemaining > 0)
+            {
+                --m_loopsRemaining;
+            }
+        }
+        else
+        {
+            m_decodeEnded.store(true, AZStd::memory_order_release);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool StreamingSoundSource::OpenDecoder()
+{
+    m_file = AZStd::make_unique<AZ::IO::FileIOStream>(m_path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    if (!m_file->IsOpen())
+    {
+        AZ_Error("StreamingSoundSource", false, "Failed to open '%s' for streaming.", m_path.c_str());
+        return false;
+    }
+
+    m_decoder = CreateSoundDecoder(m_format);
+    if (!m_decoder)
+    {
+        AZ_Error("StreamingSoundSource", false, "'%s' isn't in a format that can be streamed.", m_path.c_str());
+        return false;
+    }
+
+    m_file->Seek(static_cast<AZ::IO::OffsetType>(m_payloadOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    if (!m_decoder->Open(m_file.get(), m_payloadSize))
+    {
+        AZ_Error("StreamingSoundSource", false, "Failed to open the compressed stream in '%s'.", m_path.c_str());
+        return false;
+    }
+
+    if (m_decoder->GetChannels() != m_channels)
+    {
+        AZ_Error("StreamingSoundSource", false, "'%s' has %d channels but the asset says %d.",
+            m_path.c_str(), m_decoder->GetChannels(), m_channels);
+        m_decoder->Close();
+        return false;
+    }
+
+    return true;
+}
+
+bool StreamingSoundSource::SeekDecoder(AZ::u64 frame)
+{
+    //Jump to the last page before the frame, only that page gets decoded and thrown away.
+    const SoundSegment* seekPoint = FindSeekPoint(m_seekTable, frame);
+    if (frame > 0 && seekPoint && m_decoder->SeekToPage(seekPoint->m_byteOffset, frame))
+    {
+        return true;
+    }
+
+    if (!m_decoder->Rewind())
+    {
+        return false;
+    }
+
+    //Products without a seek table decode and throw away everything before the frame.
+    for (int ch = 0; ch < m_channels; ++ch)
+    {
+        m_channelPointers[ch] = m_scratch.data() + ch * ServiceFrames;
+    }
+
+    while (frame > 0)
+    {
+        const int toSkip = static_cast<int>(AZStd::min<AZ::u64>(frame, ServiceFrames));
+        const int decoded = m_decoder->Decode(m_channelPointers.data(), toSkip);
+        if (decoded <= 0)
+        {
+            break;
+        }
+        frame -= decoded;
+    }
+
+    return true;
+}
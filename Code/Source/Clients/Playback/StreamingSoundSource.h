@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "SoundSource.h"
+#include "Clients/Decoders/SoundDecoder.h"
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace Sune
+{
+    class SoundStreamer;
+
+    //Streams a DecodeOnDemand asset from disk through a bounded ring buffer.
+    //The SoundStreamer thread decodes ahead of the render cursor, the audio thread only copies out of the ring.
+    class StreamingSoundSource
+        : public SoundSource
+    {
+    public:
+        //Ring size per channel, about 0.7 seconds at 48kHz.
+        static constexpr AZ::u64 RingFrames = 32768;
+        //Most frames decoded per Service call so one stream can't hog the streamer.
+        static constexpr int ServiceFrames = 4096;
+
+        static std::shared_ptr<StreamingSoundSource> Create(const SoundAsset& asset);
+
+        StreamingSoundSource(const SoundAsset& asset, SoundStreamer* streamer);
+        ~StreamingSoundSource() override = default;
+
+        //SoundSource
+        int GetChannelCount() const override { return m_channels; }
+        float GetSampleRate() const override { return static_cast<float>(m_sampleRate); }
+        void Start(size_t frame, int loopCount) override;
+        int Render(float* const* channels, int frames) override;
+        bool IsFinished() const override;
+        size_t GetCursor() const override;
+
+        //Streamer thread, returns true if there is more work to do right away.
+        bool Service();
+
+    private:
+        bool OpenDecoder();
+        bool SeekDecoder(AZ::u64 frame);
+
+        SoundStreamer* m_streamer = nullptr;
+
+        //Copied from the asset, fixed after construction
+        AZStd::string m_path;
+        AZ::u64 m_payloadOffset = 0;
+        AZ::u64 m_payloadSize = 0;
+        AudioImportFormat m_format = AudioImportFormat::Vorbis;
+        int m_channels = 0;
+        int m_sampleRate = 0;
+        AZ::u64 m_totalFrames = 0;
+        AZStd::vector<SoundSegment> m_seekTable;
+
+        //Streamer thread only
+        AZStd::unique_ptr<AZ::IO::FileIOStream> m_file;
+        AZStd::unique_ptr<SoundDecoder> m_decoder;
+        AZStd::vector<float> m_scratch;
+        AZStd::vector<float*> m_channelPointers;
+        AZ::u32 m_workerSerial = 0;
+        int m_loopsRemaining = 0;
+
+        //Planar ring, RingFrames per channel.
+        AZStd::vector<float> m_ring;
+        AZStd::atomic<AZ::u64> m_readPos = 0;
+        AZStd::atomic<AZ::u64> m_writePos = 0;
+        AZStd::atomic_bool m_decodeEnded = false;
+        AZStd::atomic_bool m_failed = false;
+
+        //Start requests, the audio thread acknowledges a request before the streamer flushes the ring.
+        AZStd::atomic<AZ::u64> m_pendingFrame = 0;
+        AZStd::atomic_int m_pendingLoops = 0;
+        AZStd::atomic<AZ::u32> m_requestSerial = 0;
+        AZStd::atomic<AZ::u32> m_readerSerial = 0;
+        AZStd::atomic<AZ::u32> m_publishedSerial = 0;
+
+        //Audio thread cursor
+        AZStd::atomic<AZ::u64> m_cursorStart = 0;
+        AZStd::atomic<AZ::u64> m_renderedFrames = 0;
+    };
+}
@@ -0,0 +1,223 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Resampler.h"
+
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace Sune;
+
+namespace
+{
+    //Kaiser window shape, about 80dB of stopband attenuation past the transition band.
+    constexpr double KaiserBeta = 8.0;
+    //Passband edge as a fraction of the lower Nyquist, leaves room for the transition band.
+    constexpr double CutoffScale = 0.94;
+    constexpr double Pi = 3.14159265358979323846;
+
+    AZ::u64 GreatestCommonDivisor(AZ::u64 a, AZ::u64 b)
+    {
+        while (b != 0)
+        {
+            const AZ::u64 t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    //Zeroth order modified Bessel function of the first kind.
+    double BesselI0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        const double halfX = x * 0.5;
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= (halfX / k) * (halfX / k);
+            sum += term;
+            if (term < sum * 1e-12)
+            {
+                break;
+            }
+        }
+        return sum;
+    }
+
+    double Sinc(double x)
+    {
+        return x == 0.0 ? 1.0 : std::sin(Pi * x) / (Pi * x);
+    }
+
+    float Dot(const float* kernel, const float* samples, size_t taps)
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        __m128 sum0 = _mm_setzero_ps();
+        __m128 sum1 = _mm_setzero_ps();
+        for (size_t k = 0; k < taps; k += 8)
+        {
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(kernel + k), _mm_loadu_ps(samples + k)));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(kernel + k + 4), _mm_loadu_ps(samples + k + 4)));
+        }
+        __m128 sum = _mm_add_ps(sum0, sum1);
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+        return _mm_cvtss_f32(sum);
+#else
+        //Separate accumulators so the compiler can vectorise without reassociating.
+        float sum[4] = {};
+        for (size_t k = 0; k < taps; k += 4)
+        {
+            sum[0] += kernel[k] * samples[k];
+            sum[1] += kernel[k + 1] * samples[k + 1];
+            sum[2] += kernel[k + 2] * samples[k + 2];
+            sum[3] += kernel[k + 3] * samples[k + 3];
+        }
+        return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+#endif
+    }
+}
+
+PolyphaseResampler::PolyphaseResampler(AZ::u32 fromRate, AZ::u32 toRate)
+{
+    static_assert(Taps % 8 == 0 && MaxTaps % 8 == 0, "The kernel is summed 8 taps at a time.");
+    AZ_Assert(fromRate > 0 && toRate > 0, "Sample rates must be positive.");
+
+    const AZ::u64 divisor = GreatestCommonDivisor(fromRate, toRate);
+    m_up = toRate / divisor;
+    m_down = fromRate / divisor;
+    m_phases = AZStd::min(m_up, MaxPhases);
+
+    //The cutoff moves down by up / down when downsampling, the kernel has to get that much longer to keep its shape.
+    const double ratio = AZStd::max(1.0, static_cast<double>(m_down) / static_cast<double>(m_up));
+    const size_t scaledTaps = static_cast<size_t>(std::ceil(Taps * ratio / 8.0)) * 8;
+    m_taps = AZStd::min(scaledTaps, MaxTaps);
+    const size_t halfTaps = m_taps / 2;
+
+    //Downsampling moves the cutoff to the output's Nyquist so nothing above it folds back.
+    const double cutoff = CutoffScale * AZStd::min(1.0, static_cast<double>(m_up) / static_cast<double>(m_down));
+    const double windowScale = 1.0 / BesselI0(KaiserBeta);
+
+    m_kernels.resize(m_phases * m_taps);
+    for (AZ::u64 phase = 0; phase < m_phases; ++phase)
+    {
+        const double fraction = static_cast<double>(phase) / static_cast<double>(m_phases);
+        float* kernel = m_kernels.data() + phase * m_taps;
+
+        double sum = 0.0;
+        for (size_t k = 0; k < m_taps; ++k)
+        {
+            //Tap k reads the input halfTaps - 1 samples before the output position, plus k.
+            const double distance = static_cast<double>(k) - static_cast<double>(halfTaps - 1) - fraction;
+            const double t = distance / static_cast<double>(halfTaps);
+            const double window = BesselI0(KaiserBeta * std::sqrt(AZStd::max(0.0, 1.0 - t * t))) * windowScale;
+            const double value = cutoff * Sinc(cutoff * distance) * window;
+            kernel[k] = static_cast<float>(value);
+            sum += value;
+        }
+
+        //Every phase passes DC at unity, otherwise the phases beat against each other.
+        const float normalize = static_cast<float>(1.0 / sum);
+        for (size_t k = 0; k < m_taps; ++k)
+        {
+            kernel[k] *= normalize;
+        }
+    }
+}
+
+AZ::u64 PolyphaseResampler::GetOutputFrames(AZ::u64 inputFrames) const
+{
+    return (inputFrames * m_up + m_down - 1) / m_down;
+}
+
+void PolyphaseResampler::Process(const float* in, AZ::u64 inputFrames, size_t inStride, float* out, size_t outStride) const
+{
+    //Zero padded on both sides so the kernel never has to check for the edges.
+    AZStd::vector<float> padded(inputFrames + m_taps, 0.0f);
+    for (AZ::u64 i = 0; i < inputFrames; ++i)
+    {
+        padded[m_taps / 2 - 1 + i] = in[i * inStride];
+    }
+
+    const AZ::u64 outputFrames = GetOutputFrames(inputFrames);
+    for (AZ::u64 n = 0; n < outputFrames; ++n)
+    {
+        const AZ::u64 position = n * m_down;
+        const AZ::u64 index = position / m_up;
+        const AZ::u64 phase = (position % m_up) * m_phases / m_up;
+        out[n * outStride] = Dot(m_kernels.data() + phase * m_taps, padded.data() + index, m_taps);
+    }
+}
+
+ResamplerStream::ResamplerStream(const PolyphaseResampler& resampler, size_t maxOutputFrames)
+    : m_resampler(&resampler)
+{
+    //Downsampling can leave the next output a step past everything pushed, so allow one output more.
+    const AZ::u64 span = (static_cast<AZ::u64>(maxOutputFrames + 1) * resampler.m_down + resampler.m_up - 1) / resampler.m_up;
+    m_maxInputFrames = static_cast<size_t>(span) + resampler.m_taps;
+    m_buffer.resize(m_maxInputFrames + resampler.m_taps);
+    Reset();
+}
+
+void ResamplerStream::Reset()
+{
+    //Same leading zeros as Process so a stream matches resampling the whole signal at once.
+    m_size = m_resampler->m_taps / 2 - 1;
+    AZStd::fill(m_buffer.begin(), m_buffer.begin() + m_size, 0.0f);
+    m_index = 0;
+    m_remainder = 0;
+}
+
+size_t ResamplerStream::GetInputFramesNeeded(size_t outputFrames) const
+{
+    if (outputFrames == 0)
+    {
+        return 0;
+    }
+
+    const AZ::u64 last = m_index + (m_remainder + (outputFrames - 1) * m_resampler->m_down) / m_resampler->m_up;
+    const AZ::u64 end = last + m_resampler->m_taps;
+    return end > m_size ? static_cast<size_t>(end - m_size) : 0;
+}
+
+void ResamplerStream::Push(const float* in, size_t frames, size_t inStride)
+{
+    AZ_Assert(m_size + frames <= m_buffer.size(), "Pushed more than the stream was sized for.");
+    frames = AZStd::min(frames, m_buffer.size() - m_size);
+    for (size_t i = 0; i < frames; ++i)
+    {
+        m_buffer[m_size + i] = in[i * inStride];
+    }
+    m_size += frames;
+}
+
+size_t ResamplerStream::Pull(float* out, size_t frames, size_t outStride)
+{
+    const PolyphaseResampler& resampler = *m_resampler;
+    size_t produced = 0;
+    const size_t taps = resampler.m_taps;
+    for (; produced < frames && m_index + taps <= m_size; ++produced)
+    {
+        const AZ::u64 phase = m_remainder * resampler.m_phases / resampler.m_up;
+        out[produced * outStride] = Dot(resampler.m_kernels.data() + phase * taps, m_buffer.data() + m_index, taps);
+
+        m_remainder += resampler.m_down;
+        m_index += static_cast<size_t>(m_remainder / resampler.m_up);
+        m_remainder %= resampler.m_up;
+    }
+
+    //Drop the input no later output reads, when downsampling the next output can be past everything pushed.
+    const size_t consumed = AZStd::min(m_index, m_size);
+    AZStd::copy(m_buffer.begin() + consumed, m_buffer.begin() + m_size, m_buffer.begin());
+    m_size -= consumed;
+    m_index -= consumed;
+    return produced;
+}
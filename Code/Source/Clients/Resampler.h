@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Sune
+{
+    //Windowed sinc resampler between two fixed rates, used by the builder and by the optional resample on load.
+    //The ratio is reduced to up/down and every phase gets its own kernel, so each output sample is a single dot product.
+    class PolyphaseResampler
+    {
+    public:
+        //Input samples each output is made from when upsampling, a multiple of 8 so the kernel vectorises.
+        static constexpr size_t Taps = 32;
+        //Downsampling spreads the kernel over down / up times as many inputs, so the transition band stays the same
+        //fraction of the output rate, up to this many.
+        static constexpr size_t MaxTaps = 1024;
+        //Ratios that would need more phases than this use the nearest of MaxPhases.
+        static constexpr AZ::u64 MaxPhases = 1024;
+
+        PolyphaseResampler(AZ::u32 fromRate, AZ::u32 toRate);
+
+        AZ::u64 GetOutputFrames(AZ::u64 inputFrames) const;
+        size_t GetTaps() const { return m_taps; }
+
+        //Resamples one channel, strides are in samples so interleaved audio can be done a channel at a time.
+        //out needs room for GetOutputFrames(inputFrames) samples.
+        void Process(const float* in, AZ::u64 inputFrames, size_t inStride, float* out, size_t outStride) const;
+
+    private:
+        friend class ResamplerStream;
+
+        AZ::u64 m_up = 1;
+        AZ::u64 m_down = 1;
+        AZ::u64 m_phases = 1;
+        size_t m_taps = Taps;
+        //m_phases kernels of m_taps each
+        AZStd::vector<float> m_kernels;
+    };
+
+    //Resamples one channel a block at a time, the kernel's history and the phase carry over between blocks.
+    //Nothing is allocated after construction so it can run on the audio thread.
+    class ResamplerStream
+    {
+    public:
+        //The resampler has to outlive the stream, Pull is never asked for more than maxOutputFrames at once.
+        ResamplerStream(const PolyphaseResampler& resampler, size_t maxOutputFrames);
+
+        //Most input frames GetInputFramesNeeded can ask for.
+        size_t GetMaxInputFrames() const { return m_maxInputFrames; }
+
+        //Input frames that have to be pushed before outputFrames more outputs can be pulled.
+        size_t GetInputFramesNeeded(size_t outputFrames) const;
+
+        //Forgets the history, the next input is treated as the start of the signal.
+        void Reset();
+
+        void Push(const float* in, size_t frames, size_t inStride = 1);
+        //Writes up to frames outputs from what has been pushed, returns how many.
+        size_t Pull(float* out, size_t frames, size_t outStride = 1);
+
+    private:
+        const PolyphaseResampler* m_resampler = nullptr;
+        size_t m_maxInputFrames = 0;
+
+        //Input from m_buffer[0], the next output reads from m_index at phase m_remainder / up.
+        AZStd::vector<float> m_buffer;
+        size_t m_size = 0;
+        size_t m_index = 0;
+        AZ::u64 m_remainder = 0;
+    };
+}
@@ -0,0 +1,246 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SampleAllocator.h"
+
+#include <AzCore/std/algorithm.h>
+
+using namespace Sune;
+
+void* Sune::AllocateSampleMemory(size_t bytes, SampleGroupId group)
+{
+    return SampleAllocator::Get().Allocate(bytes, group);
+}
+
+void Sune::FreeSampleMemory(void* data, size_t bytes, SampleGroupId group)
+{
+    SampleAllocator::Get().Free(data, bytes, group);
+}
+
+SampleAllocator& SampleAllocator::Get()
+{
+    static SampleAllocator allocator;
+    return allocator;
+}
+
+SampleAllocator::SampleAllocator()
+{
+    //Group 0 is whatever was built without a preset name.
+    m_groups.emplace_back();
+}
+
+SampleAllocator::~SampleAllocator()
+{
+    for (auto& [memory, slab] : m_slabs)
+    {
+        FreePages(slab.m_memory, SlabSize);
+    }
+}
+
+size_t SampleAllocator::GetClassSize(size_t sizeClass)
+{
+    const size_t size = MinClassSize << (sizeClass / 2);
+    return sizeClass % 2 == 0 ? size : size + size / 2;
+}
+
+size_t SampleAllocator::FindSizeClass(size_t bytes)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < ClassCount && GetClassSize(sizeClass) < bytes)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+void* SampleAllocator::Allocate(size_t bytes, SampleGroupId group)
+{
+    if (bytes == 0)
+    {
+        return nullptr;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+    const size_t sizeClass = FindSizeClass(bytes);
+    void* data = nullptr;
+    if (sizeClass < ClassCount)
+    {
+        data = AllocateFromSlab(sizeClass);
+    }
+    else
+    {
+        bool largePages = false;
+        data = AllocatePages(bytes, largePages);
+        if (data != nullptr)
+        {
+            m_stats.m_largeBytes += bytes;
+            ++m_stats.m_largeAllocations;
+        }
+    }
+
+    if (data == nullptr)
+    {
+        AZ_Error("SampleAllocator", false, "Out of memory allocating %zu bytes of samples.", bytes);
+        return nullptr;
+    }
+
+    SampleGroupStats& stats = m_groups[group < m_groups.size() ? group : DefaultSampleGroup];
+    stats.m_bytes += bytes;
+    stats.m_peakBytes = AZStd::max(stats.m_peakBytes, stats.m_bytes);
+    ++stats.m_allocations;
+    return data;
+}
+
+void SampleAllocator::Free(void* data, size_t bytes, SampleGroupId group)
+{
+    if (data == nullptr)
+    {
+        return;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+    const size_t sizeClass = FindSizeClass(bytes);
+    if (sizeClass < ClassCount)
+    {
+        FreeToSlab(data, sizeClass);
+    }
+    else
+    {
+        FreePages(data, bytes);
+        m_stats.m_largeBytes -= bytes;
+        --m_stats.m_largeAllocations;
+    }
+
+    SampleGroupStats& stats = m_groups[group < m_groups.size() ? group : DefaultSampleGroup];
+    stats.m_bytes -= bytes;
+    --stats.m_allocations;
+}
+
+void* SampleAllocator::AllocateFromSlab(size_t sizeClass)
+{
+    const size_t classSize = GetClassSize(sizeClass);
+    auto& partialSlabs = m_partialSlabs[sizeClass];
+    if (partialSlabs.empty())
+    {
+        Slab* slab = AZStd::exchange(m_spareSlab, nullptr);
+        if (slab == nullptr)
+        {
+            bool largePages = false;
+            AZ::u8* memory = static_cast<AZ::u8*>(AllocatePages(SlabSize, largePages));
+            if (memory == nullptr)
+            {
+                return nullptr;
+            }
+
+            slab = &m_slabs[memory];
+            slab->m_memory = memory;
+            slab->m_largePages = largePages;
+            m_stats.m_slabBytes += SlabSize;
+            ++m_stats.m_slabs;
+            m_stats.m_largePageSlabs += largePages ? 1 : 0;
+        }
+
+        slab->m_sizeClass = sizeClass;
+        slab->m_capacity = static_cast<AZ::u32>(SlabSize / classSize);
+        slab->m_used = 0;
+        slab->m_untouched = 0;
+        slab->m_freeList = nullptr;
+        partialSlabs.push_back(slab);
+    }
+
+    Slab* slab = partialSlabs.back();
+    void* block = slab->m_freeList;
+    if (block != nullptr)
+    {
+        //Free blocks hold the next one in their first bytes.
+        slab->m_freeList = *static_cast<void**>(block);
+    }
+    else
+    {
+        block = slab->m_memory + static_cast<size_t>(slab->m_untouched++) * classSize;
+    }
+
+    if (++slab->m_used == slab->m_capacity)
+    {
+        partialSlabs.pop_back();
+    }
+    m_stats.m_slabUsedBytes += classSize;
+    return block;
+}
+
+void SampleAllocator::FreeToSlab(void* data, size_t sizeClass)
+{
+    const AZ::u8* block = static_cast<const AZ::u8*>(data);
+    auto it = m_slabs.upper_bound(block);
+    AZ_Assert(it != m_slabs.begin(), "Freeing samples that weren't allocated from a slab.");
+    --it;
+    Slab* slab = &it->second;
+    AZ_Assert(block < slab->m_memory + SlabSize && slab->m_sizeClass == sizeClass, "Freeing samples with the wrong size.");
+
+    *static_cast<void**>(data) = slab->m_freeList;
+    slab->m_freeList = data;
+    m_stats.m_slabUsedBytes -= GetClassSize(sizeClass);
+
+    auto& partialSlabs = m_partialSlabs[sizeClass];
+    if (slab->m_used-- == slab->m_capacity)
+    {
+        partialSlabs.push_back(slab);
+    }
+
+    if (slab->m_used == 0)
+    {
+        partialSlabs.erase(AZStd::find(partialSlabs.begin(), partialSlabs.end(), slab));
+        ReleaseSlab(slab);
+    }
+}
+
+void SampleAllocator::ReleaseSlab(Slab* slab)
+{
+    if (m_spareSlab == nullptr)
+    {
+        m_spareSlab = slab;
+        return;
+    }
+
+    m_stats.m_slabBytes -= SlabSize;
+    --m_stats.m_slabs;
+    m_stats.m_largePageSlabs -= slab->m_largePages ? 1 : 0;
+    FreePages(slab->m_memory, SlabSize);
+    m_slabs.erase(slab->m_memory);
+}
+
+SampleGroupId SampleAllocator::GetGroup(AZStd::string_view name)
+{
+    if (name.empty())
+    {
+        return DefaultSampleGroup;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+    for (size_t i = 1; i < m_groups.size(); ++i)
+    {
+        if (m_groups[i].m_name == name)
+        {
+            return static_cast<SampleGroupId>(i);
+        }
+    }
+
+    SampleGroupStats& stats = m_groups.emplace_back();
+    stats.m_name = name.substr(0, stats.m_name.max_size());
+    return static_cast<SampleGroupId>(m_groups.size() - 1);
+}
+
+SampleAllocatorStats SampleAllocator::GetStats() const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    return m_stats;
+}
+
+AZStd::vector<SampleGroupStats> SampleAllocator::GetGroupStats() const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    return AZStd::vector<SampleGroupStats>(m_groups.begin(), m_groups.end());
+}
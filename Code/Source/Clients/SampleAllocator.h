@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <Sune/SampleBuffer.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace Sune
+{
+    struct SampleGroupStats
+    {
+        AZStd::fixed_string<64> m_name; //Empty for assets built without a preset name
+        AZ::u64 m_bytes = 0;
+        AZ::u64 m_peakBytes = 0;
+        AZ::u32 m_allocations = 0;
+    };
+
+    struct SampleAllocatorStats
+    {
+        AZ::u64 m_slabBytes = 0; //Taken from the OS for short sounds
+        AZ::u64 m_slabUsedBytes = 0; //Of that, handed out in blocks
+        AZ::u32 m_slabs = 0;
+        AZ::u32 m_largePageSlabs = 0;
+        AZ::u64 m_largeBytes = 0; //Long sounds, each in pages of their own
+        AZ::u32 m_largeAllocations = 0;
+    };
+
+    //Where resident samples live, kept apart from the system allocator so level churn doesn't fragment the general heap.
+    //Short sounds share 2MB slabs split into size classes, on large pages where the platform gives them to us.
+    //Anything bigger than the largest class gets pages of its own that go straight back to the OS when freed.
+    //Samples can outlive the system component in the graveyard and in assets still being released, so this lives as long as the module
+    //and keeps its own bookkeeping on the OS allocator.
+    class SampleAllocator
+    {
+    public:
+        static constexpr size_t SlabSize = 2 * 1024 * 1024;
+        static constexpr size_t MinClassSize = 1024;
+        static constexpr size_t MaxClassSize = 256 * 1024;
+        //Powers of two from MinClassSize to MaxClassSize and halfway between each, nothing wastes more than a third of its block.
+        static constexpr size_t ClassCount = 17;
+
+        static SampleAllocator& Get();
+
+        void* Allocate(size_t bytes, SampleGroupId group);
+        void Free(void* data, size_t bytes, SampleGroupId group);
+
+        //Finds the group assets built with the named preset count against, adding it the first time.
+        SampleGroupId GetGroup(AZStd::string_view name);
+
+        SampleAllocatorStats GetStats() const;
+        AZStd::vector<SampleGroupStats> GetGroupStats() const;
+
+    private:
+        struct Slab
+        {
+            AZ::u8* m_memory = nullptr;
+            size_t m_sizeClass = 0;
+            AZ::u32 m_capacity = 0;
+            AZ::u32 m_used = 0;
+            //Blocks past this have never been handed out, so their pages are only touched once needed.
+            AZ::u32 m_untouched = 0;
+            void* m_freeList = nullptr;
+            bool m_largePages = false;
+        };
+
+        SampleAllocator();
+        ~SampleAllocator();
+
+        //Implemented per platform, largePages is set if the pages are large ones.
+        static void* AllocatePages(size_t bytes, bool& largePages);
+        static void FreePages(void* pages, size_t bytes);
+
+        static size_t GetClassSize(size_t sizeClass);
+        //The smallest class that fits bytes, the class count if none does.
+        static size_t FindSizeClass(size_t bytes);
+
+        void* AllocateFromSlab(size_t sizeClass);
+        void FreeToSlab(void* data, size_t sizeClass);
+        void ReleaseSlab(Slab* slab);
+
+        mutable AZStd::mutex m_mutex;
+
+        //Slabs of each class with a free block
+        AZStd::array<AZStd::vector<Slab*, AZ::OSStdAllocator>, ClassCount> m_partialSlabs;
+        //Every slab by where it starts, finds the slab a block came from.
+        AZStd::map<const AZ::u8*, Slab, AZStd::less<const AZ::u8*>, AZ::OSStdAllocator> m_slabs;
+        //One empty slab is kept around so a sound loaded and unloaded over and over doesn't go back to the OS each time.
+        Slab* m_spareSlab = nullptr;
+
+        //Indexed by SampleGroupId, there are only ever a few so names are looked up by scanning.
+        AZStd::vector<SampleGroupStats, AZ::OSStdAllocator> m_groups;
+        SampleAllocatorStats m_stats;
+    };
+}
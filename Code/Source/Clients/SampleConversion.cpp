@@ -0,0 +1,203 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SampleConversion.h"
+
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+#include <cstring>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace Sune;
+
+namespace
+{
+    constexpr float Int16Scale = 32767.0f;
+    //2^112, moves a half exponent into float range, denormals come out right for free.
+    constexpr float HalfExponentScale = 5.192296858534828e+33f;
+
+    AZ::u32 FloatBits(float value)
+    {
+        AZ::u32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    float BitsToFloat(AZ::u32 bits)
+    {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    AZ::u16 FloatToHalf(float value)
+    {
+        AZ::u32 bits = FloatBits(value);
+        const AZ::u32 sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        AZ::u32 half;
+        if (bits >= (127 + 16) << 23)
+        {
+            //Too big for a half, keep NaN as NaN and everything else becomes infinity.
+            half = bits > (255u << 23) ? 0x7e00 : 0x7c00;
+        }
+        else if (bits < (113 << 23))
+        {
+            //Half denormal, let the float adder do the rounding.
+            const AZ::u32 denormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+            half = FloatBits(BitsToFloat(bits) + BitsToFloat(denormMagic)) - denormMagic;
+        }
+        else
+        {
+            const AZ::u32 mantissaOdd = (bits >> 13) & 1;
+            bits += (static_cast<AZ::u32>(15 - 127) << 23) + 0xfff;
+            bits += mantissaOdd;
+            half = bits >> 13;
+        }
+        return static_cast<AZ::u16>(half | (sign >> 16));
+    }
+
+    float HalfToFloat(AZ::u16 half)
+    {
+        //Samples are never infinite or NaN so those aren't handled.
+        const AZ::u32 sign = static_cast<AZ::u32>(half & 0x8000) << 16;
+        const float magnitude = BitsToFloat(static_cast<AZ::u32>(half & 0x7fff) << 13) * HalfExponentScale;
+        return BitsToFloat(FloatBits(magnitude) | sign);
+    }
+
+    void UnpackInt16(const AZ::u16* in, float* out, size_t count)
+    {
+        size_t i = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        const __m128 scale = _mm_set1_ps(1.0f / Int16Scale);
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            //Sign extend by unpacking into the high half and shifting back down.
+            const __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+            const __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+            _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+            _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            out[i] = static_cast<float>(static_cast<AZ::s16>(in[i])) * (1.0f / Int16Scale);
+        }
+    }
+
+    void UnpackHalf(const AZ::u16* in, float* out, size_t count)
+    {
+        size_t i = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i signMask = _mm_set1_epi32(0x8000);
+        const __m128i magnitudeMask = _mm_set1_epi32(0x7fff);
+        const __m128 exponentScale = _mm_set1_ps(HalfExponentScale);
+        auto expand = [&](__m128i halves)
+        {
+            const __m128i sign = _mm_slli_epi32(_mm_and_si128(halves, signMask), 16);
+            const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(halves, magnitudeMask), 13);
+            const __m128 value = _mm_mul_ps(_mm_castsi128_ps(magnitude), exponentScale);
+            return _mm_or_ps(value, _mm_castsi128_ps(sign));
+        };
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            _mm_storeu_ps(out + i, expand(_mm_unpacklo_epi16(packed, zero)));
+            _mm_storeu_ps(out + i + 4, expand(_mm_unpackhi_epi16(packed, zero)));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            out[i] = HalfToFloat(in[i]);
+        }
+    }
+}
+
+void Sune::PackSamples(SamplePrecision precision, const float* in, AZ::u16* out, size_t count)
+{
+    switch (precision)
+    {
+    case SamplePrecision::Int16:
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float clamped = AZStd::clamp(in[i], -1.0f, 1.0f);
+            out[i] = static_cast<AZ::u16>(static_cast<AZ::s16>(std::lrintf(clamped * Int16Scale)));
+        }
+        break;
+    case SamplePrecision::Half:
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = FloatToHalf(in[i]);
+        }
+        break;
+    default:
+        AZ_Assert(false, "PackSamples only handles 16 bit precisions.");
+        break;
+    }
+}
+
+void Sune::UnpackSamples(SamplePrecision precision, const AZ::u16* in, float* out, size_t count)
+{
+    switch (precision)
+    {
+    case SamplePrecision::Int16:
+        UnpackInt16(in, out, count);
+        break;
+    case SamplePrecision::Half:
+        UnpackHalf(in, out, count);
+        break;
+    default:
+        AZ_Assert(false, "UnpackSamples only handles 16 bit precisions.");
+        break;
+    }
+}
+
+void Sune::DeinterleaveSamples(const float* in, size_t channels, size_t frames, float* const* out)
+{
+    if (channels == 1)
+    {
+        memcpy(out[0], in, frames * sizeof(float));
+        return;
+    }
+
+    if (channels == 2)
+    {
+        float* left = out[0];
+        float* right = out[1];
+        size_t i = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        for (; i + 4 <= frames; i += 4)
+        {
+            const __m128 first = _mm_loadu_ps(in + i * 2);
+            const __m128 second = _mm_loadu_ps(in + i * 2 + 4);
+            _mm_storeu_ps(left + i, _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(right + i, _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+#endif
+        for (; i < frames; ++i)
+        {
+            left[i] = in[i * 2];
+            right[i] = in[i * 2 + 1];
+        }
+        return;
+    }
+
+    //Channel at a time so each output is written in order.
+    for (size_t ch = 0; ch < channels; ++ch)
+    {
+        float* channel = out[ch];
+        for (size_t i = 0; i < frames; ++i)
+        {
+            channel[i] = in[i * channels + ch];
+        }
+    }
+}
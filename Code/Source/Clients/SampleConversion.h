@@ -0,0 +1,23 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+#include "Sune/SoundAsset.h"
+
+namespace Sune
+{
+    //Packs float samples into 16 bit storage, Int16 is clamped to [-1, 1] and Half rounds to nearest even.
+    void PackSamples(SamplePrecision precision, const float* in, AZ::u16* out, size_t count);
+
+    //Expands 16 bit samples back to float, this runs on the audio thread every quantum.
+    void UnpackSamples(SamplePrecision precision, const AZ::u16* in, float* out, size_t count);
+
+    //Splits frames of interleaved samples into one array per channel, stereo and mono don't go sample by sample.
+    void DeinterleaveSamples(const float* in, size_t channels, size_t frames, float* const* out);
+}
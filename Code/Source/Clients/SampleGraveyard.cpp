@@ -0,0 +1,92 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SampleGraveyard.h"
+
+#include <Sune/SoundAsset.h>
+
+#include <LabSound/core/AudioBus.h>
+
+using namespace Sune;
+
+SampleGraveyard::SampleGraveyard(bool hasRenderThread)
+    : m_hasRenderThread(hasRenderThread)
+{
+    if (SampleGraveyardInterface::Get() == nullptr)
+    {
+        SampleGraveyardInterface::Register(this);
+    }
+}
+
+SampleGraveyard::~SampleGraveyard()
+{
+    if (SampleGraveyardInterface::Get() == this)
+    {
+        SampleGraveyardInterface::Unregister(this);
+    }
+
+    //The context is gone by now, nothing can render the remaining graves.
+    AZ_Warning("SampleGraveyard", m_graves.empty() || !m_hasRenderThread,
+        "Freeing %zu sample buffers that were still waiting on the render thread.", m_graves.size());
+}
+
+void SampleGraveyard::Bury(SoundAsset& asset)
+{
+    Grave grave;
+    grave.m_bus = AZStd::move(asset.m_bus);
+    grave.m_samples = AZStd::move(asset.m_samples);
+    grave.m_compactSamples = AZStd::move(asset.m_compactSamples);
+    grave.m_sampleOwner = AZStd::move(asset.m_sampleOwner);
+    grave.m_bytes = asset.GetResidentSize();
+    asset.m_bus = nullptr;
+    asset.m_sampleData = nullptr;
+    asset.m_decodedFrames = 0;
+
+    //A quantum that started before this may still hold raw pointers, wait for the one after it to finish.
+    grave.m_releaseEpoch = m_epoch.load(AZStd::memory_order_acquire) + 2;
+
+    AZStd::scoped_lock lock(m_mutex);
+    m_pendingBytes += grave.m_bytes;
+    m_graves.push_back(AZStd::move(grave));
+}
+
+void SampleGraveyard::Collect()
+{
+    const AZ::u64 epoch = m_epoch.load(AZStd::memory_order_acquire);
+
+    AZStd::vector<Grave> released;
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        for (auto it = m_graves.begin(); it != m_graves.end();)
+        {
+            const bool quiescent = !m_hasRenderThread || epoch >= it->m_releaseEpoch;
+            //Nodes drop their bus on the render thread, until then it's still referenced.
+            const bool unreferenced = it->m_bus == nullptr || it->m_bus.use_count() == 1;
+            if (quiescent && unreferenced)
+            {
+                m_pendingBytes -= it->m_bytes;
+                released.push_back(AZStd::move(*it));
+                it = m_graves.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    //Bus first, it points at the sample memory.
+    for (Grave& grave : released)
+    {
+        grave.m_bus = nullptr;
+    }
+}
+
+AZ::u64 SampleGraveyard::GetPendingBytes() const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    return m_pendingBytes;
+}
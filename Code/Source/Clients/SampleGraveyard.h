@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <memory>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace lab
+{
+    class AudioBus;
+}
+
+namespace Sune
+{
+    class SoundAsset;
+
+    //Holds on to released sample memory until the render thread can't be reading it any more.
+    //The render thread advances an epoch once per quantum, memory is freed once a full quantum has passed
+    //since it was buried and no node holds the bus that points at it.
+    class SampleGraveyard
+    {
+    public:
+        AZ_RTTI(SampleGraveyard, "{E1A7C3F9-52D4-4B8E-96A0-3F2D7B19C4E6}");
+        AZ_CLASS_ALLOCATOR(SampleGraveyard, AZ::SystemAllocator);
+
+        //Without a render thread nothing can be reading the samples, only the bus references are waited on.
+        explicit SampleGraveyard(bool hasRenderThread);
+        virtual ~SampleGraveyard();
+
+        //Any thread, takes the asset's resident samples and bus.
+        void Bury(SoundAsset& asset);
+
+        //Render thread, once per quantum.
+        void AdvanceEpoch() { m_epoch.fetch_add(1, AZStd::memory_order_release); }
+
+        //Main thread, frees everything that is safe to free.
+        void Collect();
+
+        AZ::u64 GetPendingBytes() const;
+
+    private:
+        struct Grave
+        {
+            std::shared_ptr<lab::AudioBus> m_bus;
+            SampleBuffer<float> m_samples;
+            SampleBuffer<AZ::u16> m_compactSamples;
+            AZStd::shared_ptr<void> m_sampleOwner;
+            AZ::u64 m_bytes = 0;
+            AZ::u64 m_releaseEpoch = 0;
+        };
+
+        bool m_hasRenderThread = false;
+        AZStd::atomic<AZ::u64> m_epoch = 0;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<Grave> m_graves;
+        AZ::u64 m_pendingBytes = 0;
+    };
+
+    using SampleGraveyardInterface = AZ::Interface<SampleGraveyard>;
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SharedSampleRegistry.h"
+
+#include <Sune/SoundAsset.h>
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <cstring>
+
+using namespace Sune;
+
+SharedSampleRegistry::SharedSampleRegistry()
+{
+    if (SharedSampleRegistryInterface::Get() == nullptr)
+    {
+        SharedSampleRegistryInterface::Register(this);
+    }
+}
+
+SharedSampleRegistry::~SharedSampleRegistry()
+{
+    if (SharedSampleRegistryInterface::Get() == this)
+    {
+        SharedSampleRegistryInterface::Unregister(this);
+    }
+}
+
+AZ::Uuid SharedSampleRegistry::GetKey(const SoundAsset& asset, const AZ::Uuid& contentHash, int loadSampleRate)
+{
+    if (contentHash.IsNull())
+    {
+        return AZ::Uuid::CreateNull();
+    }
+
+    //The same payload can still end up resident differently, everything that decides how goes in the key.
+    struct KeyData
+    {
+        AZ::Uuid m_contentHash;
+        AZ::u32 m_format;
+        AZ::u32 m_precision;
+        AZ::s32 m_channels;
+        AZ::s32 m_sampleRate;
+        AZ::u64 m_totalSamples;
+        AZ::s32 m_loadSampleRate;
+    };
+    KeyData keyData;
+    memset(&keyData, 0, sizeof(keyData));
+    keyData.m_contentHash = contentHash;
+    keyData.m_format = static_cast<AZ::u32>(asset.m_importFormat);
+    keyData.m_precision = static_cast<AZ::u32>(asset.m_precision);
+    keyData.m_channels = asset.m_channels;
+    keyData.m_sampleRate = asset.m_productSampleRate;
+    keyData.m_totalSamples = asset.m_productTotalSamples;
+    keyData.m_loadSampleRate = loadSampleRate;
+    return AZ::Uuid::CreateData(&keyData, sizeof(keyData));
+}
+
+bool SharedSampleRegistry::Attach(SoundAsset& asset, const AZ::Uuid& key)
+{
+    if (key.IsNull())
+    {
+        return false;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+
+    AZStd::shared_ptr<SharedSamples> shared = it->second.lock();
+    if (!shared)
+    {
+        m_entries.erase(it);
+        return false;
+    }
+
+    AttachLocked(asset, AZStd::move(shared));
+    return true;
+}
+
+void SharedSampleRegistry::Publish(SoundAsset& asset, const AZ::Uuid& key)
+{
+    if (key.IsNull() || asset.m_sampleData == nullptr)
+    {
+        return;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+    AZStd::weak_ptr<SharedSamples>& entry = m_entries[key];
+    if (AZStd::shared_ptr<SharedSamples> shared = entry.lock())
+    {
+        //Loaded at the same time as another asset with the same content, nothing has seen this copy yet.
+        asset.m_samples.Reset();
+        asset.m_compactSamples.Reset();
+        asset.m_sampleOwner = nullptr;
+        AttachLocked(asset, AZStd::move(shared));
+        return;
+    }
+
+    //Moving the buffers keeps their memory where it is, m_sampleData stays valid.
+    auto shared = AZStd::make_shared<SharedSamples>();
+    shared->m_samples = AZStd::move(asset.m_samples);
+    shared->m_compactSamples = AZStd::move(asset.m_compactSamples);
+    shared->m_owner = AZStd::move(asset.m_sampleOwner);
+    shared->m_data = asset.m_sampleData;
+    shared->m_sampleRate = asset.m_sampleRate;
+    shared->m_totalSamples = asset.m_totalSamples;
+    entry = shared;
+    asset.m_sampleOwner = AZStd::move(shared);
+
+    //Drop entries whose samples are gone while we're here.
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        it = it->second.expired() ? m_entries.erase(it) : AZStd::next(it);
+    }
+}
+
+void SharedSampleRegistry::AttachLocked(SoundAsset& asset, AZStd::shared_ptr<SharedSamples> shared)
+{
+    asset.m_sampleData = shared->m_data;
+    asset.m_sampleRate = shared->m_sampleRate;
+    asset.m_totalSamples = shared->m_totalSamples;
+    asset.m_sampleOwner = AZStd::move(shared);
+}
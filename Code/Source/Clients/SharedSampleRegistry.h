@@ -0,0 +1,65 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
+#include <Sune/SampleBuffer.h>
+
+namespace Sune
+{
+    class SoundAsset;
+
+    //Lets assets with byte identical content share one copy of their resident samples.
+    //Copied variations, localisation fallbacks and duplicated UI sounds all end up pointing at the same memory.
+    //Entries are weak, the samples go away with the last asset using them.
+    class SharedSampleRegistry
+    {
+    public:
+        AZ_RTTI(SharedSampleRegistry, "{3B9D6E21-7C4A-4F58-A2E0-1D8C5F94B76A}");
+        AZ_CLASS_ALLOCATOR(SharedSampleRegistry, AZ::SystemAllocator);
+
+        SharedSampleRegistry();
+        virtual ~SharedSampleRegistry();
+
+        //Identifies what the resident samples will look like, contentHash is the payload hash or a hash of the samples themselves.
+        //Null if the content hash is.
+        static AZ::Uuid GetKey(const SoundAsset& asset, const AZ::Uuid& contentHash, int loadSampleRate);
+
+        //Asset loading threads
+        //Points the asset at samples another asset with the same key has resident, false if there aren't any.
+        bool Attach(SoundAsset& asset, const AZ::Uuid& key);
+        //Hands the asset's resident samples over so others can attach to them.
+        //If another asset got there first the asset's own copy is dropped and it attaches to that one instead.
+        void Publish(SoundAsset& asset, const AZ::Uuid& key);
+
+    private:
+        //Everything that owns the samples, moved out of the asset that loaded them first.
+        struct SharedSamples
+        {
+            SampleBuffer<float> m_samples;
+            SampleBuffer<AZ::u16> m_compactSamples;
+            AZStd::shared_ptr<void> m_owner;
+            void* m_data = nullptr;
+            int m_sampleRate = 0;
+            size_t m_totalSamples = 0;
+        };
+
+        static void AttachLocked(SoundAsset& asset, AZStd::shared_ptr<SharedSamples> shared);
+
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::Uuid, AZStd::weak_ptr<SharedSamples>> m_entries;
+    };
+
+    using SharedSampleRegistryInterface = AZ::Interface<SharedSampleRegistry>;
+}
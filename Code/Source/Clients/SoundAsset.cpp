@@ -6,9 +6,13 @@
  */
 #include <Sune/SoundAsset.h>
 
+#include "Adpcm.h"
+
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/ObjectStream.h>
+#include <AzCore/std/algorithm.h>
+#include <cmath>
 
 using namespace Sune;
 
@@ -20,20 +24,42 @@ void SoundAsset::Reflect(AZ::ReflectContext* context)
             ->Enum<AudioImportFormat>()
             ->Value("Uncompressed", AudioImportFormat::Uncompressed)
             ->Value("OriginalFile", AudioImportFormat::OriginalFile)
-            ->Value("Vorbis", AudioImportFormat::Vorbis);
+            ->Value("Vorbis", AudioImportFormat::Vorbis)
+            ->Value("Opus", AudioImportFormat::Opus)
+            ->Value("Adpcm", AudioImportFormat::Adpcm);
 
         serializeContext->Enum<AudioLoadMethod>()
             ->Value("DecodeOnLoad", AudioLoadMethod::DecodeOnLoad)
             ->Value("DecodeOnDemand", AudioLoadMethod::DecodeOnDemand);
 
+        serializeContext->Enum<SamplePrecision>()
+            ->Value("Float32", SamplePrecision::Float32)
+            ->Value("Int16", SamplePrecision::Int16)
+            ->Value("Half", SamplePrecision::Half);
+
+        serializeContext
+            ->Class<SoundSegment>()
+                ->Version(1)
+                ->Field("m_byteOffset", &SoundSegment::m_byteOffset)
+                ->Field("m_frame", &SoundSegment::m_frame)
+        ;
+
         serializeContext
             ->Class<SoundAsset, AZ::Data::AssetData>()
-                ->Version(2)
+                ->Version(8)
                 ->Field("m_importFormat", &SoundAsset::m_importFormat)
                 ->Field("m_loadMethod", &SoundAsset::m_loadMethod)
+                ->Field("m_precision", &SoundAsset::m_precision)
                 ->Field("m_channels", &SoundAsset::m_channels)
                 ->Field("m_sampleRate", &SoundAsset::m_sampleRate)
                 ->Field("m_totalSamples", &SoundAsset::m_totalSamples)
+                ->Field("m_segments", &SoundAsset::m_segments)
+                ->Field("m_seekTable", &SoundAsset::m_seekTable)
+                ->Field("m_payloadHash", &SoundAsset::m_payloadHash)
+                ->Field("m_loudness", &SoundAsset::m_loudness)
+                ->Field("m_truePeak", &SoundAsset::m_truePeak)
+                ->Field("m_volume", &SoundAsset::m_volume)
+                ->Field("m_presetName", &SoundAsset::m_presetName)
         ;
 
         serializeContext->RegisterGenericType<AZ::Data::Asset<SoundAsset>>();
@@ -48,6 +74,10 @@ void SoundAsset::Reflect(AZ::ReflectContext* context)
 SoundAsset::SoundAsset()
 {}
 
+SoundAsset::SoundAsset(const AZ::Data::AssetId& assetId, AssetStatus status)
+    : AZ::Data::AssetData(assetId, status)
+{}
+
 bool SoundAsset::GetLengthInSeconds(float& lengthInSeconds) const
 {
     if (m_totalSamples == 0 || m_channels == 0 || m_sampleRate == 0)
@@ -58,3 +88,45 @@ bool SoundAsset::GetLengthInSeconds(float& lengthInSeconds) const
     lengthInSeconds = static_cast<float>(channelSamples) / static_cast<float>(m_sampleRate);
     return true;
 }
+
+bool SoundAsset::IsFullyDecoded() const
+{
+    return m_sampleData != nullptr && m_channels > 0
+        && m_decodedFrames.load(AZStd::memory_order_acquire) >= m_totalSamples / static_cast<size_t>(m_channels);
+}
+
+float SoundAsset::GetNormalizedGain(float targetLoudness, float maxTruePeak) const
+{
+    if (m_loudness <= SilentLoudness)
+    {
+        return m_volume;
+    }
+
+    //Quiet sounds are only brought up as far as their peaks allow, so nothing downstream has to limit them.
+    const float gainDb = AZStd::min(targetLoudness - m_loudness, maxTruePeak - m_truePeak);
+    return m_volume * std::pow(10.0f, gainDb / 20.0f);
+}
+
+AZ::u64 SoundAsset::GetResidentSize() const
+{
+    if (m_sampleData == nullptr || m_channels <= 0)
+    {
+        return 0;
+    }
+
+    if (m_importFormat == AudioImportFormat::Adpcm)
+    {
+        return Adpcm::GetPayloadSize(m_channels, m_totalSamples / m_channels);
+    }
+    return m_totalSamples * GetSampleSize(m_precision);
+}
+
+const SoundSegment* Sune::FindSeekPoint(const AZStd::vector<SoundSegment>& seekTable, AZ::u64 frame)
+{
+    auto it = AZStd::upper_bound(seekTable.begin(), seekTable.end(), frame,
+        [](AZ::u64 value, const SoundSegment& point)
+        {
+            return value < point.m_frame;
+        });
+    return it == seekTable.begin() ? nullptr : &*(it - 1);
+}
@@ -7,15 +7,41 @@
 #include "SoundAssetHandler.h"
 
 #include "Sune/SoundAsset.h"
+#include "Adpcm.h"
+#include "DecodeCache.h"
+#include "Decoders/SoundDecoder.h"
+#include "MappedFile.h"
+#include "Resampler.h"
+#include "SampleAllocator.h"
+#include "SampleConversion.h"
+#include "SampleGraveyard.h"
+#include "SharedSampleRegistry.h"
+#include "SoundMemoryManager.h"
 
 #include <libnyquist/Common.h>
 #include <libnyquist/Decoders.h>
 
+#include "AzCore/IO/FileIO.h"
+#include "AzCore/IO/GenericStreams.h"
+#include "AzCore/Jobs/JobFunction.h"
 #include "AzCore/Serialization/Utils.h"
+#include "AzCore/std/containers/fixed_vector.h"
+#include "AzCore/std/limits.h"
+#include "AzCore/std/parallel/atomic.h"
+#include "AzCore/std/parallel/conditional_variable.h"
+#include "AzCore/std/parallel/mutex.h"
+#include "AzCore/std/smart_ptr/make_shared.h"
 #include "LabSound/core/AudioBus.h"
 
 using namespace Sune;
 
+//Tail decodes still running, the handler waits for them before it goes away.
+static AZStd::mutex g_tailDecodeMutex;
+static AZStd::condition_variable g_tailDecodesDone;
+static int g_pendingTailDecodes = 0;
+//Device rate resident samples are converted to on load, 0 leaves them at the product's rate.
+static AZStd::atomic_int g_loadSampleRate = 0;
+
 SoundAssetHandler::SoundAssetHandler()
 {
     Register();
@@ -23,6 +49,11 @@ SoundAssetHandler::SoundAssetHandler()
 
 SoundAssetHandler::~SoundAssetHandler()
 {
+    //Tail decodes hold assets this handler has to destroy.
+    {
+        AZStd::unique_lock lock(g_tailDecodeMutex);
+        g_tailDecodesDone.wait(lock, []() { return g_pendingTailDecodes == 0; });
+    }
     Unregister();
 }
 
@@ -57,198 +88,416 @@ AZ::Data::AssetPtr SoundAssetHandler::CreateAsset(const AZ::Data::AssetId& id, c
 
     return nullptr;
 }
-#include <vorbis/codec.h>
 
-[[maybe_unused]]static bool DecodeVorbisNonInterleaved(AZStd::vector<AZ::u8>& inputOggData, AZStd::vector<float>& outputPcmData, int& channels, int& sampleRate)
+static bool OpenDecoder(SoundDecoder& decoder, AZ::IO::GenericStream& stream, AZ::u64 payloadSize, const SoundAsset& soundAsset)
 {
-    ogg_sync_state sync_state;
-    ogg_stream_state stream_state;
-    ogg_page page;
-    ogg_packet packet;
-
-    vorbis_info info;
-    vorbis_comment comment;
-    vorbis_dsp_state dsp_state;
-    vorbis_block block;
-
-    ogg_sync_init(&sync_state);
-    vorbis_info_init(&info);
-    vorbis_comment_init(&comment);
-
-    const auto originialSize = inputOggData.size();
-
-    char* buffer = ogg_sync_buffer(&sync_state, originialSize);
-    memcpy(buffer, inputOggData.data(), originialSize);
-    ogg_sync_wrote(&sync_state, originialSize);
-    inputOggData = {};
+    if (!decoder.Open(&stream, payloadSize))
+    {
+        return false;
+    }
 
-    if (ogg_sync_pageout(&sync_state, &page) != 1) {
-        AZ_Error("SoundAssetHandler", false, "Ogg invalid.");
-        ogg_sync_clear(&sync_state);
-        vorbis_comment_clear(&comment);
-        vorbis_info_clear(&info);
+    if (decoder.GetChannels() != soundAsset.m_channels || decoder.GetSampleRate() != soundAsset.m_sampleRate)
+    {
+        AZ_Error("SoundAssetHandler", false, "Compressed stream is %d channels at %dHz, the asset header says %d channels at %dHz.",
+            decoder.GetChannels(), decoder.GetSampleRate(), soundAsset.m_channels, soundAsset.m_sampleRate);
         return false;
     }
+    return true;
+}
 
-    ogg_stream_init(&stream_state, ogg_page_serialno(&page));
+//Decodes frames [start, end) into their place in the planar samples.
+static bool DecodeRange(SoundDecoder& decoder, SoundAsset& soundAsset, AZ::u64 start, AZ::u64 end)
+{
+    const size_t frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    AZStd::fixed_vector<float*, 255> channelPointers(soundAsset.m_channels);
+    for (int ch = 0; ch < soundAsset.m_channels; ++ch)
+    {
+        channelPointers[ch] = soundAsset.m_samples.data() + ch * frames + start;
+    }
 
-    if (ogg_stream_pagein(&stream_state, &page) < 0)
+    const int count = static_cast<int>(end - start);
+    const int decoded = decoder.Decode(channelPointers.data(), count);
+    if (decoded < 0)
     {
-        AZ_Error("SoundAssetBuilder", false, "Error reading first page of Ogg bitstream.");
-        ogg_stream_clear(&stream_state);
-        ogg_sync_clear(&sync_state);
-        vorbis_comment_clear(&comment);
-        vorbis_info_clear(&info);
         return false;
     }
 
-    if (ogg_stream_packetout(&stream_state, &packet) != 1)
+    if (decoded < count)
     {
-        AZ_Error("SoundAssetBuilder", false, "Error reading initial header packet.");
-        ogg_stream_clear(&stream_state);
-        ogg_sync_clear(&sync_state);
-        vorbis_comment_clear(&comment);
-        vorbis_info_clear(&info);
-        return false;
+        AZ_Warning("SoundAssetHandler", false, "Compressed stream ended %d frames early, padding with silence.", count - decoded);
+        for (float* channel : channelPointers)
+        {
+            AZStd::fill(channel + decoded, channel + count, 0.0f);
+        }
     }
+    return true;
+}
+
+//The segments after the head, decoded in the background once the asset is already playable.
+struct TailDecode
+{
+    //Keeps the asset alive until every segment is decoded.
+    SoundDataAsset m_asset;
+    AZStd::vector<AZ::u8> m_payload;
 
-    if (vorbis_synthesis_headerin(&info, &comment, &packet) < 0)
+    AZStd::mutex m_mutex;
+    AZStd::vector<bool> m_decoded;
+    size_t m_contiguous = 1; //The head is decoded before the tail starts
+    bool m_failed = false;
+};
+
+static AZ::u64 GetSegmentStart(const SoundAsset& soundAsset, size_t index)
+{
+    const AZ::u64 frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    return index == 0 ? 0 : AZStd::min(soundAsset.m_segments[index - 1].m_frame, frames);
+}
+
+static AZ::u64 GetSegmentEnd(const SoundAsset& soundAsset, size_t index)
+{
+    const AZ::u64 frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    return index == soundAsset.m_segments.size() ? frames : AZStd::min(soundAsset.m_segments[index].m_frame, frames);
+}
+
+//Packs the decoded float frames [start, end) into the compact samples, the float copy goes once everything is packed.
+static void PackDecodedRange(SoundAsset& soundAsset, AZ::u64 start, AZ::u64 end)
+{
+    const AZ::u64 frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    for (int ch = 0; ch < soundAsset.m_channels; ++ch)
     {
-        AZ_Error("SoundAssetBuilder", false, "This Ogg bitstream does not contain Vorbis audio data.");
-        ogg_stream_clear(&stream_state);
-        ogg_sync_clear(&sync_state);
-        vorbis_comment_clear(&comment);
-        vorbis_info_clear(&info);
-        return false;
+        const AZ::u64 offset = ch * frames + start;
+        PackSamples(soundAsset.m_precision, soundAsset.m_samples.data() + offset, soundAsset.m_compactSamples.data() + offset, end - start);
     }
+}
 
-    int i = 0;
-    while (i < 2)
+//Publishes every segment decoded so far from the start, the last one to finish cleans up and caches the result.
+static void FinishTailSegment(TailDecode& tail, size_t index, bool decoded)
+{
+    SoundDataAsset finishedAsset;
     {
-        while (i < 2)
+        AZStd::scoped_lock lock(tail.m_mutex);
+        SoundAsset& soundAsset = *tail.m_asset.Get();
+        tail.m_decoded[index] = true;
+        tail.m_failed |= !decoded;
+
+        const size_t segmentCount = tail.m_decoded.size();
+        const size_t contiguous = tail.m_contiguous;
+        while (tail.m_contiguous < segmentCount && tail.m_decoded[tail.m_contiguous])
+        {
+            ++tail.m_contiguous;
+        }
+        if (tail.m_contiguous == contiguous)
+        {
+            return;
+        }
+
+        if (tail.m_contiguous == segmentCount)
         {
-            int result = ogg_sync_pageout(&sync_state, &page);
-            if (result == 0) break;
-            if (result == 1)
+            //Nothing reads the float copy of compact samples, and it can't be evicted until it's published below.
+            if (soundAsset.m_precision != SamplePrecision::Float32)
             {
-                ogg_stream_pagein(&stream_state, &page);
-                while (i < 2)
-                {
-                    result = ogg_stream_packetout(&stream_state, &packet);
-                    if (result == 0) break;
-                    if (result < 0)
-                    {
-                        AZ_Error("SoundAssetBuilder", false, "Corrupt secondary header.");
-                        ogg_stream_clear(&stream_state);
-                        ogg_sync_clear(&sync_state);
-                        vorbis_comment_clear(&comment);
-                        vorbis_info_clear(&info);
-                        return false;
-                    }
-                    result = vorbis_synthesis_headerin(&info, &comment, &packet);
-                    if (result < 0)
-                    {
-                        AZ_Error("SoundAssetBuilder", false, "Corrupt secondary header.");
-                        ogg_stream_clear(&stream_state);
-                        ogg_sync_clear(&sync_state);
-                        vorbis_comment_clear(&comment);
-                        vorbis_info_clear(&info);
-                        return false;
-                    }
-                    i++;
-                }
+                soundAsset.m_samples.Reset();
             }
+
+            DecodeCache* decodeCache = DecodeCacheInterface::Get();
+            if (decodeCache && !tail.m_failed)
+            {
+                decodeCache->Store(soundAsset);
+            }
+            finishedAsset = AZStd::move(tail.m_asset);
         }
+        soundAsset.m_decodedFrames.store(GetSegmentEnd(soundAsset, tail.m_contiguous - 1), AZStd::memory_order_release);
     }
 
-    channels = info.channels;
-    sampleRate = info.rate;
+    if (finishedAsset)
+    {
+        //Releasing it can destroy the asset, do it before the handler is allowed to go away.
+        finishedAsset.Reset();
+        AZStd::scoped_lock lock(g_tailDecodeMutex);
+        --g_pendingTailDecodes;
+        g_tailDecodesDone.notify_all();
+    }
+}
 
-    if (vorbis_synthesis_init(&dsp_state, &info) != 0)
+//Decodes the first segment before returning so the asset can start playing straight away,
+//every other segment decodes on its own job and is published as soon as everything before it is.
+static bool DecodeFastStart(AZ::IO::GenericStream& stream, AZ::u64 payloadSize, const SoundDataAsset& asset)
+{
+    SoundAsset& soundAsset = *asset.Get();
+
+    //The workers can't share the asset stream, give them the compressed payload instead.
+    //It's a fraction of the decoded size and goes once the last segment is decoded.
+    auto tail = AZStd::make_shared<TailDecode>();
+    tail->m_payload.resize_no_construct(payloadSize);
+    if (stream.Read(tail->m_payload.size(), tail->m_payload.data()) != tail->m_payload.size())
     {
-        AZ_Error("SoundAssetBuilder", false, "Failed to initialize Vorbis synthesis.");
-        ogg_stream_clear(&stream_state);
-        ogg_sync_clear(&sync_state);
-        vorbis_comment_clear(&comment);
-        vorbis_info_clear(&info);
+        AZ_Error("SoundAssetHandler", false, "Failed to read the compressed payload.");
         return false;
     }
-    vorbis_block_init(&dsp_state, &block);
 
-    AZStd::vector<AZStd::vector<float>> channelBuffers(channels);
-    int estimatedSamplesPerChannel = (originialSize * 8) / channels;
-    for (int ch = 0; ch < channels; ch++)
+    const AZ::u64 headEnd = GetSegmentEnd(soundAsset, 0);
     {
-        channelBuffers[ch].reserve(estimatedSamplesPerChannel);
+        AZ::IO::MemoryStream memoryStream(tail->m_payload.data(), tail->m_payload.size());
+        AZStd::unique_ptr<SoundDecoder> decoder = CreateSoundDecoder(soundAsset.m_importFormat);
+        if (!decoder || !OpenDecoder(*decoder, memoryStream, tail->m_payload.size(), soundAsset)
+            || !DecodeRange(*decoder, soundAsset, 0, headEnd))
+        {
+            return false;
+        }
     }
 
-    bool eos = false;
-    while (!eos)
+    if (soundAsset.m_precision != SamplePrecision::Float32)
     {
-        while (!eos)
+        soundAsset.m_compactSamples.Allocate(soundAsset.m_totalSamples, soundAsset.m_sampleGroup);
+        PackDecodedRange(soundAsset, 0, headEnd);
+        soundAsset.m_sampleData = soundAsset.m_compactSamples.data();
+    }
+    else
+    {
+        soundAsset.m_sampleData = soundAsset.m_samples.data();
+    }
+    soundAsset.m_decodedFrames.store(headEnd, AZStd::memory_order_release);
+
+    tail->m_asset = asset;
+    tail->m_decoded.resize(soundAsset.m_segments.size() + 1, false);
+    tail->m_decoded[0] = true;
+    {
+        AZStd::scoped_lock lock(g_tailDecodeMutex);
+        ++g_pendingTailDecodes;
+    }
+
+    for (size_t i = 1; i < tail->m_decoded.size(); ++i)
+    {
+        AZ::Job* job = AZ::CreateJobFunction([tail, i]()
         {
-            int result = ogg_sync_pageout(&sync_state, &page);
-            if (result == 0) break;
+            SoundAsset& soundAsset = *tail->m_asset.Get();
+            const AZ::u64 start = GetSegmentStart(soundAsset, i);
+            const AZ::u64 end = GetSegmentEnd(soundAsset, i);
 
-            if (result > 0)
+            bool decoded = true;
+            if (start < end)
             {
-                ogg_stream_pagein(&stream_state, &page);
-
-                while (true)
+                AZ::IO::MemoryStream memoryStream(tail->m_payload.data(), tail->m_payload.size());
+                AZStd::unique_ptr<SoundDecoder> decoder = CreateSoundDecoder(soundAsset.m_importFormat);
+                decoded = decoder && OpenDecoder(*decoder, memoryStream, tail->m_payload.size(), soundAsset)
+                    && decoder->SeekToPage(soundAsset.m_segments[i - 1].m_byteOffset, start)
+                    && DecodeRange(*decoder, soundAsset, start, end);
+                if (!decoded)
                 {
-                    result = ogg_stream_packetout(&stream_state, &packet);
-                    if (result == 0) break;
-                    if (result < 0) continue;
-
-                    if (vorbis_synthesis(&block, &packet) == 0)
-                    {
-                        vorbis_synthesis_blockin(&dsp_state, &block);
-                    }
-
-                    float** pcm;
-                    int samples;
-                    while ((samples = vorbis_synthesis_pcmout(&dsp_state, &pcm)) > 0)
+                    AZ_Error("SoundAssetHandler", false, "Failed to decode segment %zu, it will play as silence.", i);
+                    const AZ::u64 frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+                    for (int ch = 0; ch < soundAsset.m_channels; ++ch)
                     {
-                        for (int ch = 0; ch < channels; ch++)
-                        {
-                            channelBuffers[ch].insert(channelBuffers[ch].end(),
-                                                      pcm[ch], pcm[ch] + samples);
-                        }
-                        vorbis_synthesis_read(&dsp_state, samples);
+                        float* channel = soundAsset.m_samples.data() + ch * frames;
+                        AZStd::fill(channel + start, channel + end, 0.0f);
                     }
                 }
 
-                if (ogg_page_eos(&page)) eos = true;
+                if (soundAsset.m_precision != SamplePrecision::Float32)
+                {
+                    PackDecodedRange(soundAsset, start, end);
+                }
             }
-        }
+            FinishTailSegment(*tail, i, decoded);
+        }, true);
+        job->Start();
+    }
+    return true;
+}
+
+//Maps the planar PCM or ADPCM blocks that follow the header, falls back to reading them into memory if the file can't be mapped.
+static void* LoadUncompressed(AZ::IO::GenericStream& stream, SoundAsset& soundAsset)
+{
+    //The builder writes the payload in the form it's played from so it can be used as is.
+    //It starts on a page boundary of the file it's in, which is what the padding after the header is for.
+    const AZ::u64 padding = AZ_SIZE_ALIGN_UP(soundAsset.m_payloadOffset, SoundAsset::UncompressedAlignment) - soundAsset.m_payloadOffset;
+    const AZ::u64 payloadOffset = soundAsset.m_payloadOffset + padding;
+    const bool adpcm = soundAsset.m_importFormat == AudioImportFormat::Adpcm;
+    AZ::u64 payloadSize = 0;
+    if (soundAsset.m_channels > 0)
+    {
+        payloadSize = adpcm ? Adpcm::GetPayloadSize(soundAsset.m_channels, soundAsset.m_totalSamples / soundAsset.m_channels)
+                            : soundAsset.m_totalSamples * GetSampleSize(soundAsset.m_precision);
+    }
+    if (payloadSize == 0 || padding + payloadSize > soundAsset.m_payloadSize)
+    {
+        AZ_Error("SoundAssetHandler", false, "Uncompressed payload doesn't match the asset header.");
+        return nullptr;
+    }
 
-        if (!eos)
+    //Only loose files can be mapped, anything packed in an archive gets copied.
+    char resolvedPath[AZ_MAX_PATH_LEN] = {};
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (fileIO && !soundAsset.m_streamPath.empty()
+        && fileIO->ResolvePath(soundAsset.m_streamPath.c_str(), resolvedPath, sizeof(resolvedPath)))
+    {
+        if (AZStd::unique_ptr<MappedFile> mappedFile = MappedFile::Open(resolvedPath, payloadOffset, payloadSize))
         {
-            buffer = ogg_sync_buffer(&sync_state, 4096);
-            break;
+            void* data = mappedFile->GetData();
+            soundAsset.m_sampleOwner = AZStd::shared_ptr<MappedFile>(mappedFile.release());
+            return data;
         }
     }
 
-    int totalSamples = channelBuffers[0].size();
-    outputPcmData.resize(totalSamples * channels);
-    float* floatOutput = outputPcmData.data();
+    stream.Seek(static_cast<AZ::IO::OffsetType>(padding), AZ::IO::GenericStream::ST_SEEK_CUR);
+    void* data = nullptr;
+    if (adpcm)
+    {
+        auto blocks = AZStd::make_shared<SampleBuffer<AZ::u8>>();
+        blocks->Allocate(payloadSize, soundAsset.m_sampleGroup);
+        data = blocks->data();
+        soundAsset.m_sampleOwner = AZStd::move(blocks);
+    }
+    else if (soundAsset.m_precision == SamplePrecision::Float32)
+    {
+        soundAsset.m_samples.Allocate(soundAsset.m_totalSamples, soundAsset.m_sampleGroup);
+        data = soundAsset.m_samples.data();
+    }
+    else
+    {
+        soundAsset.m_compactSamples.Allocate(soundAsset.m_totalSamples, soundAsset.m_sampleGroup);
+        data = soundAsset.m_compactSamples.data();
+    }
+
+    if (stream.Read(payloadSize, data) != payloadSize)
+    {
+        AZ_Error("SoundAssetHandler", false, "Failed to read uncompressed PCM data.");
+        soundAsset.m_samples.Reset();
+        soundAsset.m_compactSamples.Reset();
+        soundAsset.m_sampleOwner = nullptr;
+        return nullptr;
+    }
+    return data;
+}
+
+//True if the resident samples get converted to the device rate once they are decoded.
+static bool NeedsLoadResample(const SoundAsset& soundAsset)
+{
+    //ADPCM stays encoded, it plays at the product's rate.
+    const int sampleRate = g_loadSampleRate.load(AZStd::memory_order_relaxed);
+    return soundAsset.m_importFormat != AudioImportFormat::Adpcm && sampleRate > 0 && soundAsset.m_sampleRate > 0
+        && soundAsset.m_sampleRate != sampleRate && soundAsset.m_channels > 0;
+}
+
+//Decodes a Vorbis or Opus payload straight into the planar samples, sized once from the asset header.
+//Segmented assets return once the head is decoded and set tailPending, the rest is published through m_decodedFrames.
+static bool DecodeCompressedNonInterleaved(AZ::IO::GenericStream& stream, AZ::u64 payloadSize, const SoundDataAsset& asset, bool& tailPending)
+{
+    SoundAsset& soundAsset = *asset.Get();
+    if (soundAsset.m_channels <= 0 || soundAsset.m_totalSamples == 0)
+    {
+        AZ_Error("SoundAssetHandler", false, "Sound asset header has no samples.");
+        return false;
+    }
+
+    const size_t frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    if (frames > static_cast<size_t>(AZStd::numeric_limits<int>::max()))
+    {
+        AZ_Error("SoundAssetHandler", false, "Compressed stream is too long to decode on load.");
+        return false;
+    }
+
+    //Every sample gets written by the decoder, no need to zero it first.
+    soundAsset.m_samples.Allocate(frames * soundAsset.m_channels, soundAsset.m_sampleGroup);
+
+    //Resampling on load needs every frame first, so those assets decode in one go instead of starting early.
+    if (!soundAsset.m_segments.empty() && !NeedsLoadResample(soundAsset))
+    {
+        tailPending = DecodeFastStart(stream, payloadSize, asset);
+        return tailPending;
+    }
+
+    AZStd::unique_ptr<SoundDecoder> decoder = CreateSoundDecoder(soundAsset.m_importFormat);
+    return decoder && OpenDecoder(*decoder, stream, payloadSize, soundAsset)
+        && DecodeRange(*decoder, soundAsset, 0, frames);
+}
+
+//Decodes WAV, FLAC, MP3 and anything else libnyquist understands into the planar samples.
+static bool DecodeOriginalFile(AZ::IO::GenericStream& stream, AZ::u64 payloadSize, SoundAsset& soundAsset)
+{
+    std::vector<uint8_t> fileData(payloadSize);
+    if (stream.Read(fileData.size(), fileData.data()) != fileData.size())
+    {
+        AZ_Error("SoundAssetHandler", false, "Failed to read the original audio file.");
+        return false;
+    }
+
+    //NyquistIO isn't safe to share between threads, a local one lets several assets load at once.
+    nqr::NyquistIO nyquistIO;
+    nqr::AudioData audioData;
+    nyquistIO.Load(&audioData, fileData);
+    fileData = {};
 
-    for (int ch = 0; ch < channels; ch++)
+    if (audioData.channelCount != soundAsset.m_channels || audioData.sampleRate != soundAsset.m_sampleRate
+        || audioData.samples.size() != soundAsset.m_totalSamples || audioData.samples.empty())
     {
-        memcpy(floatOutput + ch * totalSamples,
-            channelBuffers[ch].data(),
-            totalSamples * sizeof(float));
+        AZ_Error("SoundAssetHandler", false, "Decoded audio doesn't match the asset header.");
+        return false;
     }
 
-    ogg_stream_clear(&stream_state);
-    ogg_sync_clear(&sync_state);
-    vorbis_comment_clear(&comment);
-    vorbis_info_clear(&info);
-    vorbis_block_clear(&block);
-    vorbis_dsp_clear(&dsp_state);
+    //libnyquist only decodes interleaved, deinterleave straight into the final layout.
+    const size_t frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    soundAsset.m_samples.Allocate(soundAsset.m_totalSamples, soundAsset.m_sampleGroup);
+    nqr::DeinterleaveChannels(audioData.samples.data(), soundAsset.m_samples.data(), frames, soundAsset.m_channels, frames);
     return true;
 }
 
+//Packs decoded float samples down to the resident precision, returns the samples to play from.
+static void* CompactDecodedSamples(SoundAsset& soundAsset)
+{
+    soundAsset.m_totalSamples = soundAsset.m_samples.size();
+    if (soundAsset.m_precision == SamplePrecision::Float32)
+    {
+        return soundAsset.m_samples.data();
+    }
+
+    //Only the compact copy stays resident.
+    soundAsset.m_compactSamples.Allocate(soundAsset.m_totalSamples, soundAsset.m_sampleGroup);
+    PackSamples(soundAsset.m_precision, soundAsset.m_samples.data(), soundAsset.m_compactSamples.data(), soundAsset.m_totalSamples);
+    soundAsset.m_samples.Reset();
+    return soundAsset.m_compactSamples.data();
+}
+
+//Converts the resident samples to the device rate once, so voices don't have to resample them every quantum.
+static void ResampleToLoadRate(SoundAsset& soundAsset)
+{
+    if (!NeedsLoadResample(soundAsset))
+    {
+        return;
+    }
+
+    const int sampleRate = g_loadSampleRate.load(AZStd::memory_order_relaxed);
+    const PolyphaseResampler resampler(soundAsset.m_sampleRate, sampleRate);
+    const AZ::u64 frames = soundAsset.m_totalSamples / soundAsset.m_channels;
+    const AZ::u64 resampledFrames = resampler.GetOutputFrames(frames);
+
+    SampleBuffer<float> resampled;
+    resampled.Allocate(resampledFrames * soundAsset.m_channels, soundAsset.m_sampleGroup);
+    AZStd::vector<float> unpacked;
+    for (int ch = 0; ch < soundAsset.m_channels; ++ch)
+    {
+        const float* channel = nullptr;
+        if (soundAsset.m_precision == SamplePrecision::Float32)
+        {
+            channel = static_cast<const float*>(soundAsset.m_sampleData) + ch * frames;
+        }
+        else
+        {
+            //Compact samples are only expanded a channel at a time.
+            unpacked.resize_no_construct(frames);
+            UnpackSamples(soundAsset.m_precision, static_cast<const AZ::u16*>(soundAsset.m_sampleData) + ch * frames, unpacked.data(), frames);
+            channel = unpacked.data();
+        }
+        resampler.Process(channel, frames, 1, resampled.data() + ch * resampledFrames, 1);
+    }
+
+    //Drops the old samples, including a mapping of an uncompressed asset.
+    soundAsset.m_sampleRate = sampleRate;
+    soundAsset.m_samples = AZStd::move(resampled);
+    soundAsset.m_compactSamples.Reset();
+    soundAsset.m_sampleOwner = nullptr;
+    soundAsset.m_sampleData = CompactDecodedSamples(soundAsset);
+}
+
 AZ::Data::AssetHandler::LoadResult SoundAssetHandler::LoadAssetData(const AZ::Data::Asset<AZ::Data::AssetData>& asset,
     AZStd::shared_ptr<AZ::Data::AssetDataStream> stream, const AZ::Data::AssetFilterCB& assetLoadFilterCB)
 {
@@ -259,70 +508,212 @@ AZ::Data::AssetHandler::LoadResult SoundAssetHandler::LoadAssetData(const AZ::Da
         return AssetHandler::LoadResult::Error;
     }
 
-    SoundAsset* soundAsset = asset.GetAs<SoundAsset>();
-    switch (soundAsset->m_loadMethod)
+    //Remember where the payload is so it can be streamed, or loaded again if it gets evicted.
+    if (!LoadSoundPayload(SoundDataAsset(asset), *stream, stream->GetFilename(), stream->GetCurPos(),
+        stream->GetLength() - stream->GetCurPos()))
+    {
+        return LoadResult::Error;
+    }
+    return LoadResult::LoadComplete;
+}
+
+bool SoundAssetHandler::LoadSoundPayload(const SoundDataAsset& asset, AZ::IO::GenericStream& stream, const char* productPath,
+    AZ::u64 payloadOffset, AZ::u64 payloadSize)
+{
+    SoundAsset& soundAsset = *asset.Get();
+    soundAsset.m_streamPath = productPath;
+    soundAsset.m_payloadOffset = payloadOffset;
+    soundAsset.m_payloadSize = payloadSize;
+    soundAsset.m_productSampleRate = soundAsset.m_sampleRate;
+    soundAsset.m_productTotalSamples = soundAsset.m_totalSamples;
+
+    switch (soundAsset.m_loadMethod)
     {
     case AudioLoadMethod::DecodeOnLoad:
-        return HandleDecodeOnLoad(soundAsset, stream);
+        if (!LoadResidentSamples(asset, stream))
+        {
+            return false;
+        }
+
+        if (SoundMemoryManager* memoryManager = SoundMemoryManagerInterface::Get())
+        {
+            memoryManager->Track(soundAsset);
+        }
+        return true;
     case AudioLoadMethod::DecodeOnDemand:
-        return HandleDecodeOnDemand(soundAsset, stream);
+        if (soundAsset.m_importFormat != AudioImportFormat::Vorbis && soundAsset.m_importFormat != AudioImportFormat::Opus)
+        {
+            AZ_Error(__FUNCTION__, false, "Only Vorbis and Opus assets can be streamed.");
+            return false;
+        }
+
+        //Nothing is decoded here, StreamingSoundSource reopens the product and reads the payload as it plays.
+        if (soundAsset.m_streamPath.empty() || soundAsset.m_payloadSize == 0)
+        {
+            AZ_Error(__FUNCTION__, false, "Sound asset has no streamable payload.");
+            return false;
+        }
+        return true;
     default:
         AZ_Error(__FUNCTION__, false, "Unsupported load method");
-        return LoadResult::Error;
+        return false;
     }
-
-    return LoadResult::LoadComplete;
 }
 
-AZ::Data::AssetHandler::LoadResult SoundAssetHandler::HandleDecodeOnLoad(SoundAsset* soundAsset, AZStd::shared_ptr<AZ::Data::AssetDataStream> stream)
+bool SoundAssetHandler::LoadResidentSamples(const SoundDataAsset& asset, AZ::IO::GenericStream& stream)
 {
-    //Read the rest into memory
-    auto start = stream->GetCurPos();
-    auto readSize = stream->GetLength() - start;
-    AZStd::vector<AZ::u8> fileBuffer(readSize);
-    const size_t bytesRead = stream->Read(fileBuffer.size(), fileBuffer.data());
-    if (bytesRead != readSize)
+    SoundAsset& soundAsset = *asset.Get();
+    //The stream can run past the payload when the product is a member of a bank.
+    const AZ::u64 payloadSize = soundAsset.m_payloadSize;
+
+    //A reload starts from the product again, the last load may have resampled it.
+    soundAsset.m_sampleRate = soundAsset.m_productSampleRate;
+    soundAsset.m_totalSamples = soundAsset.m_productTotalSamples;
+    soundAsset.m_sampleGroup = SampleAllocator::Get().GetGroup(soundAsset.m_presetName);
+
+    //Another asset with the same content may already have the samples resident, then there is nothing to load.
+    SharedSampleRegistry* sharedSamples = SharedSampleRegistryInterface::Get();
+    const int loadSampleRate = g_loadSampleRate.load(AZStd::memory_order_relaxed);
+    AZ::Uuid shareKey = SharedSampleRegistry::GetKey(soundAsset, soundAsset.m_payloadHash, loadSampleRate);
+    const bool shared = sharedSamples != nullptr && sharedSamples->Attach(soundAsset, shareKey);
+
+    //Compressed formats can skip decoding entirely if this machine has decoded them before.
+    DecodeCache* decodeCache = DecodeCacheInterface::Get();
+    const bool cacheable = !shared && decodeCache != nullptr && soundAsset.m_importFormat != AudioImportFormat::Uncompressed
+        && soundAsset.m_importFormat != AudioImportFormat::Adpcm;
+
+    void* data = shared ? soundAsset.m_sampleData : nullptr;
+    if (cacheable)
     {
-        AZ_Error(__FUNCTION__, false, "Failed to read source file.");
-        return LoadResult::Error;
+        data = decodeCache->Load(soundAsset);
     }
-
-    switch (soundAsset->m_importFormat)
+    const bool cacheHit = cacheable && data != nullptr;
+    bool tailPending = false;
+    if (data == nullptr)
     {
-    case AudioImportFormat::Vorbis:
-        if (!DecodeVorbisNonInterleaved(fileBuffer, soundAsset->m_samples, soundAsset->m_channels, soundAsset->m_sampleRate))
+        switch (soundAsset.m_importFormat)
         {
-            AZ_Error(__FUNCTION__, false, "Failed to decode OGG Vorbis data.");
-            return LoadResult::Error;
+        case AudioImportFormat::Vorbis:
+        case AudioImportFormat::Opus:
+            //Feed the decoder from the stream, only fast start buffers the compressed payload for its tail jobs.
+            if (!DecodeCompressedNonInterleaved(stream, payloadSize, asset, tailPending))
+            {
+                AZ_Error(__FUNCTION__, false, "Failed to decode the compressed audio data.");
+                return false;
+            }
+            //The tail packs and caches itself as it finishes.
+            data = tailPending ? soundAsset.m_sampleData : CompactDecodedSamples(soundAsset);
+            break;
+        case AudioImportFormat::OriginalFile:
+            if (!DecodeOriginalFile(stream, payloadSize, soundAsset))
+            {
+                AZ_Error(__FUNCTION__, false, "Failed to decode the original audio file.");
+                return false;
+            }
+            data = CompactDecodedSamples(soundAsset);
+            break;
+        case AudioImportFormat::Uncompressed:
+        case AudioImportFormat::Adpcm:
+            //ADPCM isn't decoded here, CompactSoundSource decodes a block at a time as it plays.
+            data = LoadUncompressed(stream, soundAsset);
+            if (data == nullptr)
+            {
+                AZ_Error(__FUNCTION__, false, "Failed to load uncompressed audio data.");
+                return false;
+            }
+            break;
+        default:
+            AZ_Error(__FUNCTION__, false, "Unsupported import format");
+            return false;
         }
-        soundAsset->m_totalSamples = soundAsset->m_samples.size();
+    }
+    soundAsset.m_sampleData = data;
 
-        //Share a universal buffer for every labsound player to share.
-        //this lab::AudioBus isn't allocating anything and is just pointing at our existing memory.
-        soundAsset->m_bus = std::make_shared<lab::AudioBus>(soundAsset->m_channels, soundAsset->m_totalSamples / soundAsset->m_channels, false);
-        soundAsset->m_bus->setSampleRate(soundAsset->m_sampleRate);
+    if (!tailPending)
+    {
+        if (!shared)
         {
-            auto length = soundAsset->m_totalSamples  / soundAsset->m_channels;
-            float* data = (float*)soundAsset->m_samples.data();
-            for (int i = 0; i < soundAsset->m_channels; ++i)
+            if (cacheable && !cacheHit)
+            {
+                decodeCache->Store(soundAsset);
+            }
+            //After caching so the cache entry still matches the product.
+            //Fast start assets keep the product rate, their tail is still being decoded in place.
+            ResampleToLoadRate(soundAsset);
+
+            //Fast start assets aren't shared, their tail is still being written.
+            if (sharedSamples != nullptr)
             {
-                float* channelMemory = data + (i * length);
-                soundAsset->m_bus->setChannelMemory(i, channelMemory, length);
+                if (shareKey.IsNull())
+                {
+                    //Products built before the payload hash was added are matched on what they decoded to.
+                    shareKey = SharedSampleRegistry::GetKey(soundAsset,
+                        AZ::Uuid::CreateData(soundAsset.m_sampleData, soundAsset.GetResidentSize()), loadSampleRate);
+                }
+                sharedSamples->Publish(soundAsset, shareKey);
             }
         }
-        return LoadResult::LoadComplete;
-    default:
-        AZ_Error(__FUNCTION__, false, "Unsupported import format");
-        return LoadResult::Error;
+        data = soundAsset.m_sampleData;
+        soundAsset.m_decodedFrames.store(soundAsset.m_totalSamples / soundAsset.m_channels, AZStd::memory_order_release);
     }
 
-    return LoadResult::Error;
+    if (soundAsset.m_precision != SamplePrecision::Float32 || soundAsset.m_importFormat == AudioImportFormat::Adpcm)
+    {
+        //Compact samples are played through a CompactSoundSource, LabSound buses are float only.
+        return true;
+    }
+
+    //Share a universal buffer for every labsound player to share.
+    //this lab::AudioBus isn't allocating anything and is just pointing at our existing memory.
+    //Assets sharing samples each get their own, the graveyard goes by who still references an asset's bus.
+    soundAsset.m_bus = std::make_shared<lab::AudioBus>(soundAsset.m_channels, soundAsset.m_totalSamples / soundAsset.m_channels, false);
+    soundAsset.m_bus->setSampleRate(soundAsset.m_sampleRate);
+    {
+        auto length = soundAsset.m_totalSamples  / soundAsset.m_channels;
+        float* samples = static_cast<float*>(data);
+        for (int i = 0; i < soundAsset.m_channels; ++i)
+        {
+            float* channelMemory = samples + (i * length);
+            soundAsset.m_bus->setChannelMemory(i, channelMemory, length);
+        }
+    }
+    return true;
 }
 
-AZ::Data::AssetHandler::LoadResult SoundAssetHandler::HandleDecodeOnDemand(SoundAsset* soundAsset, AZStd::shared_ptr<AZ::Data::AssetDataStream> )
+bool SoundAssetHandler::ReloadResidentSamples(const SoundDataAsset& asset)
 {
-    //TODO: We need to improve labsound to support streaming audio, this will be done but for now just fail to process.
-    return LoadResult::Error;
+    const SoundAsset& soundAsset = *asset.Get();
+    AZ::IO::FileIOStream stream(soundAsset.m_streamPath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    if (!stream.IsOpen())
+    {
+        AZ_Error("SoundAssetHandler", false, "Failed to reopen '%s' to load its samples again.", soundAsset.m_streamPath.c_str());
+        return false;
+    }
+
+    stream.Seek(static_cast<AZ::IO::OffsetType>(soundAsset.m_payloadOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+    return LoadResidentSamples(asset, stream);
+}
+
+void SoundAssetHandler::ReleaseResidentSamples(SoundAsset& soundAsset)
+{
+    if (SampleGraveyard* graveyard = SampleGraveyardInterface::Get())
+    {
+        //The render thread may still be reading them, the graveyard frees them once it can't be.
+        graveyard->Bury(soundAsset);
+        return;
+    }
+
+    soundAsset.m_bus = nullptr;
+    soundAsset.m_sampleData = nullptr;
+    soundAsset.m_decodedFrames = 0;
+    soundAsset.m_samples.Reset();
+    soundAsset.m_compactSamples.Reset();
+    soundAsset.m_sampleOwner = nullptr;
+}
+
+void SoundAssetHandler::SetLoadSampleRate(int sampleRate)
+{
+    g_loadSampleRate = sampleRate;
 }
 
 void SoundAssetHandler::DestroyAsset(AZ::Data::AssetPtr ptr)
@@ -330,19 +721,18 @@ void SoundAssetHandler::DestroyAsset(AZ::Data::AssetPtr ptr)
     SoundAsset* asset = azdynamic_cast<SoundAsset*>(ptr);
     if (!asset)
     {
+        delete ptr;
         return;
     }
 
-    if (asset->m_bus.use_count() > 1)
+    if (SoundMemoryManager* memoryManager = SoundMemoryManagerInterface::Get())
     {
-        AZ_Error("SoundAssetHandler", false, "LabSound AudioBus is still in use.");
-        //It's probably better to possibly leak memory than destroy the users ears.
-        //If it just resulted in a crash, then I'd be fine with that, but playing loud static? nah.
-        return;
+        memoryManager->Untrack(*asset);
     }
 
-    asset->m_bus = nullptr;
-    asset->m_samples.clear();
+    //A node can still be rendering the bus, never free the samples out from under it.
+    ReleaseResidentSamples(*asset);
+    delete asset;
 }
 
 void SoundAssetHandler::GetHandledAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes)
@@ -9,6 +9,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/IO/GenericStreams.h>
 
 namespace Sune
 {
@@ -39,8 +40,20 @@ namespace Sune
         AZ::Uuid GetComponentTypeId() const override;
         bool CanCreateComponent(const AZ::Data::AssetId& assetId) const override;
 
-    private:
-        LoadResult HandleDecodeOnLoad(SoundAsset* soundAsset, AZStd::shared_ptr<AZ::Data::AssetDataStream> );
-        LoadResult HandleDecodeOnDemand(SoundAsset* soundAsset, AZStd::shared_ptr<AZ::Data::AssetDataStream> );
+        //Loads a sound whose header was just read, its payloadSize byte payload follows at the stream's position.
+        //productPath and payloadOffset say where that payload is on disk, so it can be streamed or loaded again later.
+        //Streamed sounds don't read the stream at all.
+        static bool LoadSoundPayload(const AZ::Data::Asset<SoundAsset>& asset, AZ::IO::GenericStream& stream, const char* productPath,
+            AZ::u64 payloadOffset, AZ::u64 payloadSize);
+        //Decodes or maps the payload at the stream's position into the asset's resident samples and bus.
+        //Fast start keeps a reference to the asset until the tail is decoded.
+        static bool LoadResidentSamples(const AZ::Data::Asset<SoundAsset>& asset, AZ::IO::GenericStream& stream);
+        //Reopens the product and loads the resident samples again after they were released.
+        static bool ReloadResidentSamples(const AZ::Data::Asset<SoundAsset>& asset);
+        //Frees the resident samples, nothing can still be rendering them.
+        static void ReleaseResidentSamples(SoundAsset& soundAsset);
+
+        //Resident samples loaded from now on are resampled to this rate once, 0 keeps the rate they were built at.
+        static void SetLoadSampleRate(int sampleRate);
     };
 }
@@ -0,0 +1,45 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include <Sune/SoundBankAsset.h>
+
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+using namespace Sune;
+
+void SoundBankAsset::Reflect(AZ::ReflectContext* context)
+{
+    if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+    {
+        serializeContext
+            ->Class<SoundBankEntry>()
+                ->Version(1)
+                ->Field("m_assetId", &SoundBankEntry::m_assetId)
+                ->Field("m_offset", &SoundBankEntry::m_offset)
+                ->Field("m_size", &SoundBankEntry::m_size)
+        ;
+
+        serializeContext
+            ->Class<SoundBankAsset, AZ::Data::AssetData>()
+                ->Version(1)
+                ->Field("m_entries", &SoundBankAsset::m_entries)
+        ;
+
+        serializeContext->RegisterGenericType<AZ::Data::Asset<SoundBankAsset>>();
+
+        if (auto* editContext = serializeContext->GetEditContext())
+        {
+            editContext->Class<SoundBankAsset>("Sune SoundBankAsset", "")->ClassElement(AZ::Edit::ClassElements::EditorData, "");
+        }
+    }
+}
+
+SoundDataAsset SoundBankAsset::FindMember(const AZ::Data::AssetId& assetId) const
+{
+    auto it = m_members.find(assetId);
+    return it != m_members.end() ? it->second : SoundDataAsset();
+}
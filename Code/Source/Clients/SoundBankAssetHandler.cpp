@@ -0,0 +1,229 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBankAssetHandler.h"
+
+#include "Sune/SoundBankAsset.h"
+#include "SoundAssetHandler.h"
+
+#include "AzCore/IO/GenericStreams.h"
+#include "AzCore/Jobs/JobCompletion.h"
+#include "AzCore/Jobs/JobFunction.h"
+#include "AzCore/Serialization/Utils.h"
+#include "AzCore/std/parallel/atomic.h"
+
+using namespace Sune;
+
+SoundBankAssetHandler::SoundBankAssetHandler()
+{
+    Register();
+}
+
+SoundBankAssetHandler::~SoundBankAssetHandler()
+{
+    Unregister();
+}
+
+void SoundBankAssetHandler::Register()
+{
+    const bool assetManagerReady = AZ::Data::AssetManager::IsReady();
+    AZ_Error("SoundBankAssetHandler", assetManagerReady, "Asset manager isn't ready.");
+    if (assetManagerReady)
+    {
+        AZ::Data::AssetManager::Instance().RegisterHandler(this, AZ::AzTypeInfo<SoundBankAsset>::Uuid());
+    }
+
+    AZ::AssetTypeInfoBus::Handler::BusConnect(AZ::AzTypeInfo<SoundBankAsset>::Uuid());
+}
+
+void SoundBankAssetHandler::Unregister()
+{
+    AZ::AssetTypeInfoBus::Handler::BusDisconnect();
+
+    if (AZ::Data::AssetManager::IsReady())
+    {
+        AZ::Data::AssetManager::Instance().UnregisterHandler(this);
+    }
+}
+
+AZ::Data::AssetPtr SoundBankAssetHandler::CreateAsset(const AZ::Data::AssetId& id, const AZ::Data::AssetType& type)
+{
+    if (type == AZ::AzTypeInfo<SoundBankAsset>::Uuid())
+    {
+        return aznew SoundBankAsset();
+    }
+
+    return nullptr;
+}
+
+AZ::Data::AssetHandler::LoadResult SoundBankAssetHandler::LoadAssetData(const AZ::Data::Asset<AZ::Data::AssetData>& asset,
+    AZStd::shared_ptr<AZ::Data::AssetDataStream> stream, const AZ::Data::AssetFilterCB& assetLoadFilterCB)
+{
+    SoundBankAsset* bank = asset.GetAs<SoundBankAsset>();
+    if (!AZ::Utils::LoadObjectFromStreamInPlace<SoundBankAsset>(*stream, *bank))
+    {
+        AZ_Error(__FUNCTION__, false, "Failed to load sound bank index.");
+        return LoadResult::Error;
+    }
+
+    const AZ::u64 dataOffset = AZ_SIZE_ALIGN_UP(stream->GetCurPos(), SoundBankAsset::MemberAlignment);
+    const AZ::u64 length = stream->GetLength();
+    for (const SoundBankEntry& entry : bank->m_entries)
+    {
+        if (dataOffset > length || entry.m_offset + entry.m_size > length - dataOffset)
+        {
+            AZ_Error(__FUNCTION__, false, "Sound bank '%s' has a member past the end of the file.", stream->GetFilename());
+            return LoadResult::Error;
+        }
+    }
+
+    //Headers are read in order on this thread, only the payloads that have to be decoded are read into memory.
+    //Streamed members play straight out of the bank file so nothing past their header is read here.
+    struct PendingMember
+    {
+        SoundDataAsset m_asset;
+        AZStd::vector<AZ::u8> m_payload;
+        AZ::u64 m_payloadOffset = 0;
+    };
+
+    const AZStd::string bankPath = stream->GetFilename();
+    AZStd::vector<SoundDataAsset> members(bank->m_entries.size());
+    AZStd::vector<PendingMember> residentMembers;
+    for (size_t i = 0; i < bank->m_entries.size(); ++i)
+    {
+        const SoundBankEntry& entry = bank->m_entries[i];
+
+        //Members aren't registered with the asset manager, so a sound already loaded on its own is shared instead of loaded twice.
+        SoundDataAsset standalone = AZ::Data::AssetManager::Instance().FindAsset<SoundAsset>(entry.m_assetId,
+            AZ::Data::AssetLoadBehavior::Default);
+        if (standalone.IsReady())
+        {
+            members[i] = AZStd::move(standalone);
+            continue;
+        }
+
+        SoundDataAsset member(aznew SoundAsset(entry.m_assetId, AZ::Data::AssetData::AssetStatus::Ready),
+            AZ::Data::AssetLoadBehavior::Default);
+        const AZ::u64 memberOffset = dataOffset + entry.m_offset;
+        stream->Seek(static_cast<AZ::IO::OffsetType>(memberOffset), AZ::IO::GenericStream::ST_SEEK_BEGIN);
+        const bool headerLoaded = AZ::Utils::LoadObjectFromStreamInPlace<SoundAsset>(*stream, *member.Get());
+        const AZ::u64 payloadOffset = stream->GetCurPos();
+        if (!headerLoaded || payloadOffset > memberOffset + entry.m_size)
+        {
+            AZ_Error(__FUNCTION__, false, "Failed to load the header of member %s of sound bank '%s'.",
+                entry.m_assetId.ToString<AZStd::string>().c_str(), bankPath.c_str());
+            return LoadResult::Error;
+        }
+
+        const AZ::u64 payloadSize = memberOffset + entry.m_size - payloadOffset;
+        if (member->m_loadMethod != AudioLoadMethod::DecodeOnLoad)
+        {
+            //Reloads and streaming read the payload straight out of the bank file.
+            if (!SoundAssetHandler::LoadSoundPayload(member, *stream, bankPath.c_str(), payloadOffset, payloadSize))
+            {
+                AZ_Error(__FUNCTION__, false, "Failed to load member %s of sound bank '%s'.",
+                    entry.m_assetId.ToString<AZStd::string>().c_str(), bankPath.c_str());
+                return LoadResult::Error;
+            }
+            members[i] = AZStd::move(member);
+            continue;
+        }
+
+        residentMembers.emplace_back();
+        PendingMember& pending = residentMembers.back();
+        pending.m_payload.resize_no_construct(payloadSize);
+        if (stream->Read(pending.m_payload.size(), pending.m_payload.data()) != pending.m_payload.size())
+        {
+            AZ_Error(__FUNCTION__, false, "Failed to read member %s of sound bank '%s'.",
+                entry.m_assetId.ToString<AZStd::string>().c_str(), bankPath.c_str());
+            return LoadResult::Error;
+        }
+        pending.m_asset = member;
+        pending.m_payloadOffset = payloadOffset;
+        members[i] = AZStd::move(member);
+    }
+
+    //Resident members are decoded on their own jobs, each one only touches its own payload and asset.
+    AZStd::atomic_int failures = 0;
+    AZ::JobCompletion completion;
+    for (PendingMember& pending : residentMembers)
+    {
+        AZ::Job* job = AZ::CreateJobFunction([&]()
+        {
+            AZ::IO::MemoryStream memberStream(pending.m_payload.data(), pending.m_payload.size());
+            if (!SoundAssetHandler::LoadSoundPayload(pending.m_asset, memberStream, bankPath.c_str(),
+                pending.m_payloadOffset, pending.m_payload.size()))
+            {
+                AZ_Error("SoundBankAssetHandler", false, "Failed to load member %s of sound bank '%s'.",
+                    pending.m_asset.GetId().ToString<AZStd::string>().c_str(), bankPath.c_str());
+                ++failures;
+            }
+            //Decoded, the compressed copy isn't needed any more.
+            pending.m_payload = {};
+        }, true);
+        job->SetDependent(&completion);
+        job->Start();
+    }
+    completion.StartAndWaitForCompletion();
+
+    if (failures > 0)
+    {
+        return LoadResult::Error;
+    }
+
+    for (SoundDataAsset& member : members)
+    {
+        const AZ::Data::AssetId memberId = member.GetId();
+        bank->m_members[memberId] = AZStd::move(member);
+    }
+    return LoadResult::LoadComplete;
+}
+
+void SoundBankAssetHandler::DestroyAsset(AZ::Data::AssetPtr ptr)
+{
+    //Members outlive the bank while players still hold them.
+    delete ptr;
+}
+
+void SoundBankAssetHandler::GetHandledAssetTypes(AZStd::vector<AZ::Data::AssetType>& assetTypes)
+{
+    assetTypes.push_back(AZ::AzTypeInfo<SoundBankAsset>::Uuid());
+}
+
+AZ::Data::AssetType SoundBankAssetHandler::GetAssetType() const
+{
+    return AZ::AzTypeInfo<SoundBankAsset>::Uuid();
+}
+
+void SoundBankAssetHandler::GetAssetTypeExtensions(AZStd::vector<AZStd::string>& extensions)
+{
+    extensions.push_back(SoundBankAsset::FileExtension);
+}
+
+const char* SoundBankAssetHandler::GetAssetTypeDisplayName() const
+{
+    return "Sound Bank (Sune Gem)";
+}
+
+const char* SoundBankAssetHandler::GetBrowserIcon() const
+{
+    return "Icons/Components/ColliderMesh.svg";
+}
+
+const char* SoundBankAssetHandler::GetGroup() const
+{
+    return "Sound";
+}
+
+AZ::Uuid SoundBankAssetHandler::GetComponentTypeId() const
+{
+    return AZ::Uuid::CreateNull();
+}
+
+bool SoundBankAssetHandler::CanCreateComponent(const AZ::Data::AssetId& assetId) const
+{
+    return false;
+}
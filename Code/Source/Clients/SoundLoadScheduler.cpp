@@ -0,0 +1,220 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundLoadScheduler.h"
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace Sune;
+
+SoundLoadPriority SoundLoadScheduler::Request::GetPriority() const
+{
+    SoundLoadPriority priority = SoundLoadPriority::Prefetch;
+    for (const auto& [ticket, ticketPriority] : m_tickets)
+    {
+        priority = AZStd::min(priority, ticketPriority);
+    }
+    return priority;
+}
+
+SoundLoadScheduler::SoundLoadScheduler(AZ::u32 maxConcurrentLoads)
+    : m_maxConcurrentLoads(AZStd::max(maxConcurrentLoads, 1u))
+{
+    if (SoundLoadSchedulerInterface::Get() == nullptr)
+    {
+        SoundLoadSchedulerInterface::Register(this);
+    }
+}
+
+SoundLoadScheduler::~SoundLoadScheduler()
+{
+    AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+
+    if (SoundLoadSchedulerInterface::Get() == this)
+    {
+        SoundLoadSchedulerInterface::Unregister(this);
+    }
+}
+
+SoundDataAsset SoundLoadScheduler::RequestLoad(const AZ::Data::AssetId& assetId, SoundLoadPriority priority, SoundLoadTicket& ticket)
+{
+    ticket = InvalidSoundLoadTicket;
+
+    auto it = m_requests.find(assetId);
+    if (it == m_requests.end())
+    {
+        //Creating it doesn't start the load, Dispatch does once there's a slot.
+        SoundDataAsset asset = AZ::Data::AssetManager::Instance().FindOrCreateAsset<SoundAsset>(assetId, AZ::Data::AssetLoadBehavior::PreLoad);
+        if (!asset)
+        {
+            return {};
+        }
+
+        //Already loaded or loading for someone else.
+        const AZ::Data::AssetData::AssetStatus status = asset.GetStatus();
+        if (status != AZ::Data::AssetData::AssetStatus::NotLoaded && status != AZ::Data::AssetData::AssetStatus::Error)
+        {
+            return asset;
+        }
+
+        Request request;
+        request.m_asset = asset;
+        request.m_sequence = m_nextSequence++;
+        it = m_requests.emplace(assetId, AZStd::move(request)).first;
+    }
+
+    ticket = ++m_nextTicket;
+    it->second.m_tickets.emplace_back(ticket, priority);
+    m_tickets[ticket] = assetId;
+
+    Dispatch();
+    return it->second.m_asset;
+}
+
+void SoundLoadScheduler::Cancel(SoundLoadTicket ticket)
+{
+    auto ticketIt = m_tickets.find(ticket);
+    if (ticketIt == m_tickets.end())
+    {
+        return;
+    }
+
+    auto it = m_requests.find(ticketIt->second);
+    m_tickets.erase(ticketIt);
+    if (it == m_requests.end())
+    {
+        return;
+    }
+
+    Request& request = it->second;
+    request.m_tickets.erase(
+        AZStd::remove_if(request.m_tickets.begin(), request.m_tickets.end(),
+            [ticket](const auto& entry)
+            {
+                return entry.first == ticket;
+            }),
+        request.m_tickets.end());
+
+    //Loads already started can't be taken back, they keep their slot until the asset manager is done.
+    if (request.m_tickets.empty() && !request.m_loading)
+    {
+        m_requests.erase(it);
+        ++m_cancelled;
+    }
+}
+
+void SoundLoadScheduler::SetPriority(SoundLoadTicket ticket, SoundLoadPriority priority)
+{
+    auto ticketIt = m_tickets.find(ticket);
+    if (ticketIt == m_tickets.end())
+    {
+        return;
+    }
+
+    auto it = m_requests.find(ticketIt->second);
+    if (it == m_requests.end())
+    {
+        return;
+    }
+
+    for (auto& entry : it->second.m_tickets)
+    {
+        if (entry.first == ticket)
+        {
+            entry.second = priority;
+        }
+    }
+
+    //A waiting request that became critical doesn't wait any more.
+    Dispatch();
+}
+
+AZ::u32 SoundLoadScheduler::GetQueuedCount() const
+{
+    return static_cast<AZ::u32>(m_requests.size()) - m_loading;
+}
+
+void SoundLoadScheduler::Dispatch()
+{
+    for (;;)
+    {
+        //There are only ever a handful waiting, a scan is cheaper than keeping a heap in order as priorities change.
+        Request* next = nullptr;
+        AZ::Data::AssetId nextId;
+        for (auto& [assetId, request] : m_requests)
+        {
+            if (request.m_loading)
+            {
+                continue;
+            }
+            if (next == nullptr || AZStd::make_pair(request.GetPriority(), request.m_sequence) < AZStd::make_pair(next->GetPriority(), next->m_sequence))
+            {
+                next = &request;
+                nextId = assetId;
+            }
+        }
+
+        if (next == nullptr || (m_loading >= m_maxConcurrentLoads && next->GetPriority() != SoundLoadPriority::Critical))
+        {
+            return;
+        }
+
+        next->m_loading = true;
+        ++m_loading;
+        //Connecting to an asset that's already loaded calls OnAssetReady straight away, which finishes and erases the request.
+        //Hold the handle ourselves and don't touch the request again unless it's still waiting on the load.
+        SoundDataAsset asset = next->m_asset;
+        AZ::Data::AssetBus::MultiHandler::BusConnect(nextId);
+        auto it = m_requests.find(nextId);
+        if (it == m_requests.end() || !it->second.m_loading)
+        {
+            continue;
+        }
+        if (!asset.QueueLoad())
+        {
+            AZ_Error("Sune", false, "Failed to queue load of sound %s", nextId.ToString<AZStd::string>().c_str());
+            Finish(nextId);
+        }
+    }
+}
+
+void SoundLoadScheduler::Finish(const AZ::Data::AssetId& assetId)
+{
+    auto it = m_requests.find(assetId);
+    if (it == m_requests.end() || !it->second.m_loading)
+    {
+        return;
+    }
+
+    AZ::Data::AssetBus::MultiHandler::BusDisconnect(assetId);
+    --m_loading;
+
+    //Players hold the asset themselves, the request isn't needed any more.
+    for (const auto& [ticket, priority] : it->second.m_tickets)
+    {
+        m_tickets.erase(ticket);
+    }
+    m_requests.erase(it);
+}
+
+void SoundLoadScheduler::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+{
+    Finish(asset.GetId());
+    Dispatch();
+}
+
+void SoundLoadScheduler::OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset)
+{
+    Finish(asset.GetId());
+    Dispatch();
+}
+
+void SoundLoadScheduler::OnAssetCanceled(AZ::Data::AssetId assetId)
+{
+    Finish(assetId);
+    Dispatch();
+}
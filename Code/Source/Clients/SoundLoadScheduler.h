@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <Sune/SoundAsset.h>
+#include <Sune/SuneBus.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Sune
+{
+    using SoundLoadTicket = AZ::u64;
+    constexpr SoundLoadTicket InvalidSoundLoadTicket = 0;
+
+    //Starts sound asset loads a few at a time in priority order, so a level full of players doesn't queue every decode at once
+    //and hold up rendering and streaming I/O behind it.
+    //Critical loads don't wait for a slot. Requests still waiting can be cancelled, ones already loading run to the end.
+    //The number of loads at once comes from /Audio/MaxConcurrentLoads.
+    class SoundLoadScheduler
+        : protected AZ::Data::AssetBus::MultiHandler
+    {
+    public:
+        AZ_RTTI(SoundLoadScheduler, "{8D2F6B14-C7A9-4E35-B0D1-5E93A7C2F468}");
+        AZ_CLASS_ALLOCATOR(SoundLoadScheduler, AZ::SystemAllocator);
+
+        static constexpr AZ::u32 DefaultMaxConcurrentLoads = 2;
+
+        explicit SoundLoadScheduler(AZ::u32 maxConcurrentLoads);
+        virtual ~SoundLoadScheduler();
+
+        //Main thread
+        //Returns the asset straight away, listen on the AssetBus for it to be ready.
+        //Requests for the same asset share one load at the highest priority asked for.
+        //ticket is only set if the load has to wait for, or is taking, a slot.
+        SoundDataAsset RequestLoad(const AZ::Data::AssetId& assetId, SoundLoadPriority priority, SoundLoadTicket& ticket);
+        //Drops the request, the asset isn't loaded if nothing else still wants it.
+        void Cancel(SoundLoadTicket ticket);
+        void SetPriority(SoundLoadTicket ticket, SoundLoadPriority priority);
+
+        AZ::u32 GetQueuedCount() const;
+        AZ::u32 GetLoadingCount() const { return m_loading; }
+        AZ::u64 GetCancelledCount() const { return m_cancelled; }
+
+    protected:
+        //AssetBus
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetError(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+        void OnAssetCanceled(AZ::Data::AssetId assetId) override;
+
+    private:
+        struct Request
+        {
+            SoundDataAsset m_asset;
+            AZStd::vector<AZStd::pair<SoundLoadTicket, SoundLoadPriority>> m_tickets;
+            AZ::u64 m_sequence = 0; //First come first served within a priority
+            bool m_loading = false;
+
+            SoundLoadPriority GetPriority() const;
+        };
+
+        //Starts as many waiting requests as there are free slots for.
+        void Dispatch();
+        void Finish(const AZ::Data::AssetId& assetId);
+
+        AZ::u32 m_maxConcurrentLoads = DefaultMaxConcurrentLoads;
+        AZ::u32 m_loading = 0;
+        AZ::u64 m_cancelled = 0;
+        AZ::u64 m_nextSequence = 0;
+        SoundLoadTicket m_nextTicket = InvalidSoundLoadTicket;
+
+        AZStd::unordered_map<AZ::Data::AssetId, Request> m_requests;
+        AZStd::unordered_map<SoundLoadTicket, AZ::Data::AssetId> m_tickets;
+    };
+
+    using SoundLoadSchedulerInterface = AZ::Interface<SoundLoadScheduler>;
+}
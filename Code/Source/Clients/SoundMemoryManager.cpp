@@ -0,0 +1,293 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundMemoryManager.h"
+
+#include "SoundAssetHandler.h"
+
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+
+using namespace Sune;
+
+SoundMemoryManager::SoundMemoryManager(AZ::u64 budgetBytes, float idleSeconds)
+    : m_budgetBytes(budgetBytes)
+    , m_idleTime(AZStd::chrono::duration_cast<AZStd::chrono::steady_clock::duration>(AZStd::chrono::duration<float>(idleSeconds)))
+{
+    if (SoundMemoryManagerInterface::Get() == nullptr)
+    {
+        SoundMemoryManagerInterface::Register(this);
+    }
+}
+
+SoundMemoryManager::~SoundMemoryManager()
+{
+    //Reload jobs write into assets we track, let them finish first.
+    {
+        AZStd::unique_lock lock(m_mutex);
+        m_reloadsDone.wait(lock, [this]() { return m_pendingReloads == 0; });
+    }
+
+    if (SoundMemoryManagerInterface::Get() == this)
+    {
+        SoundMemoryManagerInterface::Unregister(this);
+    }
+}
+
+AZ::u64 SoundMemoryManager::GetResidentBytes(const SoundAsset& asset)
+{
+    return asset.GetResidentSize();
+}
+
+void SoundMemoryManager::AddResidentBytes(Record& record)
+{
+    record.m_bytes = GetResidentBytes(*record.m_asset);
+    record.m_data = record.m_asset->m_sampleData;
+    if (record.m_bytes == 0)
+    {
+        return;
+    }
+
+    if (m_dataUsers[record.m_data]++ == 0)
+    {
+        m_residentBytes += record.m_bytes;
+    }
+    else
+    {
+        m_sharedBytes += record.m_bytes;
+    }
+}
+
+void SoundMemoryManager::RemoveResidentBytes(Record& record)
+{
+    auto it = m_dataUsers.find(record.m_data);
+    if (record.m_bytes > 0 && it != m_dataUsers.end())
+    {
+        if (--it->second == 0)
+        {
+            m_dataUsers.erase(it);
+            m_residentBytes -= record.m_bytes;
+        }
+        else
+        {
+            m_sharedBytes -= record.m_bytes;
+        }
+    }
+    record.m_bytes = 0;
+    record.m_data = nullptr;
+}
+
+void SoundMemoryManager::Track(SoundAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    Record& record = m_records[&asset];
+    RemoveResidentBytes(record);
+
+    record.m_asset = &asset;
+    record.m_lastUse = AZStd::chrono::steady_clock::now();
+    record.m_state = State::Resident;
+    AddResidentBytes(record);
+}
+
+void SoundMemoryManager::Untrack(const SoundAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    if (it != m_records.end())
+    {
+        RemoveResidentBytes(it->second);
+        m_records.erase(it);
+    }
+}
+
+bool SoundMemoryManager::Acquire(const SoundDataAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(asset.Get());
+    if (it == m_records.end())
+    {
+        //Not something we manage, it's resident for as long as it's loaded.
+        return true;
+    }
+
+    Record& record = it->second;
+    record.m_lastUse = AZStd::chrono::steady_clock::now();
+    switch (record.m_state)
+    {
+    case State::Evicting:
+        record.m_state = State::Resident;
+        return true;
+    case State::Resident:
+        return true;
+    case State::Reloading:
+        return false;
+    default:
+        break;
+    }
+
+    record.m_state = State::Reloading;
+    ++m_reloads;
+    ++m_pendingReloads;
+
+    //The job keeps its own reference so the asset can't be destroyed under it.
+    AZ::Job* job = AZ::CreateJobFunction([this, asset]() mutable
+    {
+        SoundAsset& soundAsset = *asset.Get();
+        const bool loaded = SoundAssetHandler::ReloadResidentSamples(asset);
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            auto it = m_records.find(&soundAsset);
+            if (it != m_records.end())
+            {
+                AddResidentBytes(it->second);
+                it->second.m_state = loaded ? State::Resident : State::Evicted;
+            }
+        }
+        AZ_Error("SoundMemoryManager", loaded, "Failed to load '%s' again after it was evicted.", soundAsset.m_streamPath.c_str());
+        //Drop the reference before the manager is allowed to go away, releasing it can destroy the asset.
+        asset.Reset();
+
+        //Notified under the lock, once the destructor can see the count it may destroy the condition variable.
+        AZStd::scoped_lock lock(m_mutex);
+        --m_pendingReloads;
+        m_reloadsDone.notify_all();
+    }, true);
+    job->Start();
+    return false;
+}
+
+void SoundMemoryManager::Touch(const SoundAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    if (it != m_records.end())
+    {
+        it->second.m_lastUse = AZStd::chrono::steady_clock::now();
+        if (it->second.m_state == State::Evicting)
+        {
+            it->second.m_state = State::Resident;
+        }
+    }
+}
+
+bool SoundMemoryManager::IsResident(const SoundAsset& asset) const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    return it == m_records.end() || it->second.m_state == State::Resident || it->second.m_state == State::Evicting;
+}
+
+bool SoundMemoryManager::IsEvicting(const SoundAsset& asset) const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    return it != m_records.end() && it->second.m_state == State::Evicting;
+}
+
+void SoundMemoryManager::Bind(const SoundAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    if (it != m_records.end())
+    {
+        ++it->second.m_bindings;
+    }
+}
+
+void SoundMemoryManager::Unbind(const SoundAsset& asset)
+{
+    AZStd::scoped_lock lock(m_mutex);
+    auto it = m_records.find(&asset);
+    if (it != m_records.end())
+    {
+        AZ_Assert(it->second.m_bindings > 0, "Unbalanced SoundMemoryManager::Unbind.");
+        --it->second.m_bindings;
+    }
+}
+
+void SoundMemoryManager::Update()
+{
+    if (!HasBudget())
+    {
+        return;
+    }
+
+    AZStd::scoped_lock lock(m_mutex);
+
+    //Anything already on its way out counts as gone when picking what else to evict.
+    AZ::u64 keptBytes = 0;
+    AZStd::vector<Record*> candidates;
+    const auto idleSince = AZStd::chrono::steady_clock::now() - m_idleTime;
+    for (auto& [asset, record] : m_records)
+    {
+        if (record.m_state != State::Resident)
+        {
+            continue;
+        }
+
+        //Shared samples only go once every asset using them is evicted, each counts for its part.
+        const auto users = m_dataUsers.find(record.m_data);
+        keptBytes += users != m_dataUsers.end() ? record.m_bytes / users->second : record.m_bytes;
+        //A tail that is still decoding writes into the samples, it can't be freed until it's done.
+        if (record.m_lastUse < idleSince && record.m_asset->IsFullyDecoded())
+        {
+            candidates.push_back(&record);
+        }
+    }
+
+    if (keptBytes > m_budgetBytes)
+    {
+        AZStd::sort(candidates.begin(), candidates.end(), [](const Record* a, const Record* b)
+        {
+            return a->m_lastUse < b->m_lastUse;
+        });
+
+        for (Record* record : candidates)
+        {
+            if (keptBytes <= m_budgetBytes)
+            {
+                break;
+            }
+            record->m_state = State::Evicting;
+            const auto users = m_dataUsers.find(record->m_data);
+            keptBytes -= users != m_dataUsers.end() ? record->m_bytes / users->second : record->m_bytes;
+        }
+    }
+
+    for (auto& [asset, record] : m_records)
+    {
+        //Players let go of it first, the graveyard waits out the render thread.
+        if (record.m_state != State::Evicting || record.m_bindings > 0)
+        {
+            continue;
+        }
+
+        SoundAssetHandler::ReleaseResidentSamples(*record.m_asset);
+        RemoveResidentBytes(record);
+        record.m_state = State::Evicted;
+        ++m_evictions;
+    }
+}
+
+SoundMemoryStats SoundMemoryManager::GetStats() const
+{
+    AZStd::scoped_lock lock(m_mutex);
+    SoundMemoryStats stats;
+    stats.m_residentBytes = m_residentBytes;
+    stats.m_sharedBytes = m_sharedBytes;
+    stats.m_budgetBytes = m_budgetBytes;
+    stats.m_evictions = m_evictions;
+    stats.m_reloads = m_reloads;
+    for (const auto& [asset, record] : m_records)
+    {
+        if (record.m_bytes > 0)
+        {
+            ++stats.m_residentAssets;
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,102 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <Sune/SoundAsset.h>
+#include <Sune/SuneBus.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Sune
+{
+    //Keeps the decoded samples of DecodeOnLoad assets under a memory budget.
+    //Assets that haven't been played for a while are evicted least recently used first, and loaded again the next time a player needs them.
+    //The budget comes from /Audio/MemoryBudgetMB, usually overridden per platform, 0 means unlimited.
+    class SoundMemoryManager
+    {
+    public:
+        AZ_RTTI(SoundMemoryManager, "{5D8E2B47-A1C3-4F96-B0E2-7C4A19D36F85}");
+        AZ_CLASS_ALLOCATOR(SoundMemoryManager, AZ::SystemAllocator);
+
+        //How long an asset has to go unplayed before it can be evicted.
+        static constexpr float DefaultIdleSeconds = 10.0f;
+
+        SoundMemoryManager(AZ::u64 budgetBytes, float idleSeconds);
+        virtual ~SoundMemoryManager();
+
+        bool HasBudget() const { return m_budgetBytes > 0; }
+
+        //Asset loading threads, called once an asset's samples are first resident and when it's destroyed.
+        void Track(SoundAsset& asset);
+        void Untrack(const SoundAsset& asset);
+
+        //Main thread
+        //Marks the asset as used, returns false if it isn't resident and starts loading it again.
+        bool Acquire(const SoundDataAsset& asset);
+        //Marks a resident asset as used without loading it.
+        void Touch(const SoundAsset& asset);
+        bool IsResident(const SoundAsset& asset) const;
+        //True once the asset has been picked for eviction, players should let go of it unless they are playing it.
+        bool IsEvicting(const SoundAsset& asset) const;
+
+        //Players hold a binding while their nodes reference the asset's samples, bound assets are never freed.
+        void Bind(const SoundAsset& asset);
+        void Unbind(const SoundAsset& asset);
+
+        //Frees released assets and picks new ones to evict if over budget.
+        void Update();
+
+        SoundMemoryStats GetStats() const;
+
+    private:
+        enum class State
+        {
+            Resident,
+            Evicting,
+            Evicted,
+            Reloading,
+        };
+
+        struct Record
+        {
+            SoundAsset* m_asset = nullptr;
+            AZ::u64 m_bytes = 0;
+            const void* m_data = nullptr; //What m_bytes was counted against
+            AZStd::chrono::steady_clock::time_point m_lastUse;
+            int m_bindings = 0;
+            State m_state = State::Resident;
+        };
+
+        static AZ::u64 GetResidentBytes(const SoundAsset& asset);
+        //Samples shared between assets are only resident once, the other assets count towards m_sharedBytes.
+        void AddResidentBytes(Record& record);
+        void RemoveResidentBytes(Record& record);
+
+        AZ::u64 m_budgetBytes = 0;
+        AZStd::chrono::steady_clock::duration m_idleTime;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<const SoundAsset*, Record> m_records;
+        AZ::u64 m_residentBytes = 0;
+        AZ::u64 m_sharedBytes = 0;
+        //Tracked assets using each resident buffer
+        AZStd::unordered_map<const void*, AZ::u32> m_dataUsers;
+        AZ::u64 m_evictions = 0;
+        AZ::u64 m_reloads = 0;
+
+        //Reload jobs still running, guarded by m_mutex.
+        int m_pendingReloads = 0;
+        AZStd::condition_variable m_reloadsDone;
+    };
+
+    using SoundMemoryManagerInterface = AZ::Interface<SoundMemoryManager>;
+}
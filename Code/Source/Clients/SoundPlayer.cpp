@@ -10,6 +10,9 @@
 #include "AzCore/Math/Sfmt.h"
 #include "AzCore/std/algorithm.h"
 #include "Effects/LabHrtfEffect.h"
+#include "Playback/SoundSource.h"
+#include "Playback/SoundSourceNode.h"
+#include "SoundMemoryManager.h"
 #include "LabSound/core/AudioBus.h"
 #include "LabSound/core/AudioContext.h"
 #include "LabSound/core/SampledAudioNode.h"
@@ -34,6 +37,8 @@ SoundPlayer::SoundPlayer(SoundPlayerId id) : m_id(id)
     AZ_Assert(m_node, "Failed to create SampledAudioNode");
     m_gainNode = std::make_shared<lab::GainNode>(*ctx);
     AZ_Assert(m_gainNode, "Failed to create GainNode");
+    m_sourceNode = std::make_shared<SoundSourceNode>(*ctx);
+    AZ_Assert(m_sourceNode, "Failed to create SoundSourceNode");
 
     SoundPlayer::SetBus("Default");
 }
@@ -42,6 +47,7 @@ SoundPlayer::~SoundPlayer()
 {
     AZ::Data::AssetBus::MultiHandler::BusDisconnect();
     SoundPlayerRequestBus::Handler::BusDisconnect();
+    CancelLoad();
 
     for (auto& effect : m_effects)
     {
@@ -51,7 +57,10 @@ SoundPlayer::~SoundPlayer()
 
     m_node = nullptr;
     m_gainNode = nullptr;
+    m_sourceNode = nullptr;
+    m_source = nullptr;
     m_assetBus = nullptr;
+    UnbindResident();
     m_currentAsset = AZ::Data::Asset<AZ::Data::AssetData>();
     m_pendingAsset = AZ::Data::Asset<AZ::Data::AssetData>();
 }
@@ -126,7 +135,31 @@ void SoundPlayer::SetAsset(const AZ::Data::AssetId assetId)
         return;
     }
 
-    auto asset = AZ::Data::AssetManager::Instance().GetAsset<SoundAsset>(assetId, AZ::Data::AssetLoadBehavior::PreLoad);
+    //A loaded bank already has the sound ready, no need to load it on its own.
+    SoundDataAsset asset;
+    if (SuneRequests* sune = SuneInterface::Get())
+    {
+        asset = sune->FindSoundBankMember(assetId);
+    }
+
+    //Whatever we were waiting on before isn't wanted any more, if it hasn't started loading it won't.
+    CancelLoad();
+    if (m_assetId.IsValid())
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect(m_assetId);
+    }
+
+    if (!asset)
+    {
+        if (SoundLoadScheduler* scheduler = SoundLoadSchedulerInterface::Get())
+        {
+            asset = scheduler->RequestLoad(assetId, m_loadPriority, m_loadTicket);
+        }
+        else
+        {
+            asset = AZ::Data::AssetManager::Instance().GetAsset<SoundAsset>(assetId, AZ::Data::AssetLoadBehavior::PreLoad);
+        }
+    }
     if (!asset)
     {
         AZ_Error("Sune", false, "Failed to load asset %s", assetId.ToString<AZStd::string>().c_str());
@@ -151,6 +184,34 @@ AZ::Data::AssetId SoundPlayer::GetAsset()
     return m_assetId;
 }
 
+void SoundPlayer::SetLoadPriority(SoundLoadPriority priority)
+{
+    m_loadPriority = priority;
+    if (m_loadTicket == InvalidSoundLoadTicket)
+    {
+        return;
+    }
+
+    if (SoundLoadScheduler* scheduler = SoundLoadSchedulerInterface::Get())
+    {
+        scheduler->SetPriority(m_loadTicket, priority);
+    }
+}
+
+void SoundPlayer::CancelLoad()
+{
+    if (m_loadTicket == InvalidSoundLoadTicket)
+    {
+        return;
+    }
+
+    if (SoundLoadScheduler* scheduler = SoundLoadSchedulerInterface::Get())
+    {
+        scheduler->Cancel(m_loadTicket);
+    }
+    m_loadTicket = InvalidSoundLoadTicket;
+}
+
 void SoundPlayer::SetPlayMultiple(bool canPlayMultiple)
 {
     m_canPlayMultiple = canPlayMultiple;
@@ -158,12 +219,13 @@ void SoundPlayer::SetPlayMultiple(bool canPlayMultiple)
 
 void SoundPlayer::SetGain(float gain)
 {
-    m_gainNode->gain()->setValue(gain);
+    m_gain = gain;
+    m_gainNode->gain()->setValue(m_gain * m_assetGain);
 }
 
 float SoundPlayer::GetGain()
 {
-    return m_gainNode->gain()->value();
+    return m_gain;
 }
 
 AZ::Data::Asset<SoundAsset> SoundPlayer::GetAssetData()
@@ -174,13 +236,14 @@ AZ::Data::Asset<SoundAsset> SoundPlayer::GetAssetData()
 
 float SoundPlayer::GetLengthInSeconds()
 {
-    if (m_currentAsset.GetId() != m_assetId || !m_currentAsset.IsReady())
+    //The header stays loaded even if the samples get evicted.
+    if (m_pendingAsset.GetId() != m_assetId || !m_pendingAsset.IsReady())
     {
         return 0.0f;
     }
 
     float result = 0;
-    if (!m_currentAsset->GetLengthInSeconds(result))
+    if (!m_pendingAsset->GetLengthInSeconds(result))
     {
         return 0.0f;
     }
@@ -190,12 +253,12 @@ float SoundPlayer::GetLengthInSeconds()
 
 int SoundPlayer::GetSampleRate()
 {
-    if (m_currentAsset.GetId() != m_assetId)
+    if (m_pendingAsset.GetId() != m_assetId || !m_pendingAsset.IsReady())
     {
         return 0;
     }
 
-    return m_currentAsset->m_sampleRate;
+    return m_pendingAsset->m_sampleRate;
 }
 
 void SoundPlayer::Play()
@@ -211,6 +274,14 @@ void SoundPlayer::Play()
         //Still in the process of waiting on the bus to be loaded
         auto ctx = SuneInterface::Get()->GetLabContext();
         m_schedPlayEvents.push_back({ctx->currentTime()});
+        RequestResident();
+        return;
+    }
+
+    SwitchToBusOnceDecoded();
+    if (m_source)
+    {
+        StartSource(0.0, 0);
         return;
     }
 
@@ -235,6 +306,14 @@ void SoundPlayer::PlayAtSeconds(float seconds)
         //Still in the process of waiting on the bus to be loaded
         auto ctx = SuneInterface::Get()->GetLabContext();
         m_schedPlayEvents.push_back({ctx->currentTime() + seconds});
+        RequestResident();
+        return;
+    }
+
+    SwitchToBusOnceDecoded();
+    if (m_source)
+    {
+        StartSource(seconds, 0);
         return;
     }
 
@@ -258,6 +337,14 @@ void SoundPlayer::PlayLooping(int loopCount, float seconds)
     {
         auto ctx = SuneInterface::Get()->GetLabContext();
         m_schedPlayEvents.push_back({ctx->currentTime() + seconds, loopCount});
+        RequestResident();
+        return;
+    }
+
+    SwitchToBusOnceDecoded();
+    if (m_source)
+    {
+        StartSource(seconds, loopCount);
         return;
     }
 
@@ -272,10 +359,126 @@ void SoundPlayer::PlayLooping(int loopCount, float seconds)
 void SoundPlayer::StopAll()
 {
     m_node->clearPlayback();
+    m_sourceNode->stop(0.0);
+    if (m_source)
+    {
+        m_source->Stop();
+    }
+}
+
+void SoundPlayer::SwitchToBusOnceDecoded()
+{
+    if (!m_source || IsPlaying() || !m_residentAsset.IsReady() || m_residentAsset->m_bus == nullptr
+        || NeedsSoundSource(*m_residentAsset.Get()))
+    {
+        return;
+    }
+
+    //Voices on the bus don't pay for the source's conversion, and SampledAudioNode handles the rate itself.
+    auto ctx = SuneInterface::Get()->GetLabContext();
+    m_sourceNode->SetSource(*ctx, nullptr);
+    m_source = nullptr;
+    m_assetBus = m_residentAsset->m_bus;
+    m_node->setBus(m_assetBus);
+    ReconnectGraph();
+}
+
+void SoundPlayer::StartSource(double offsetSeconds, int loopCount)
+{
+    //Streams only have one read position so AddVoice restarts them.
+    const size_t frame = static_cast<size_t>(AZStd::max(offsetSeconds, 0.0) * m_source->GetSampleRate());
+    if (m_canPlayMultiple)
+    {
+        m_source->AddVoice(frame, loopCount);
+    }
+    else
+    {
+        m_source->Start(frame, loopCount);
+    }
+    m_sourceNode->start(0.0f);
+}
+
+void SoundPlayer::RequestResident()
+{
+    //Something wants to play it, it can't wait behind prefetches any more.
+    if (m_loadTicket != InvalidSoundLoadTicket)
+    {
+        if (SoundLoadScheduler* scheduler = SoundLoadSchedulerInterface::Get())
+        {
+            scheduler->SetPriority(m_loadTicket, SoundLoadPriority::Critical);
+        }
+    }
+
+    SoundMemoryManager* memoryManager = SoundMemoryManagerInterface::Get();
+    if (memoryManager == nullptr || !m_pendingAsset.IsReady() || m_pendingAsset.GetId() != m_assetId)
+    {
+        //Still loading for the first time, OnAssetReady picks up the queued events.
+        return;
+    }
+
+    if (memoryManager->Acquire(m_pendingAsset))
+    {
+        OnAssetReady(m_pendingAsset);
+    }
+}
+
+void SoundPlayer::ReleaseResident()
+{
+    auto ctx = SuneInterface::Get()->GetLabContext();
+    StopAll();
+    m_node->setBus(nullptr);
+    m_sourceNode->SetSource(*ctx, nullptr);
+    m_source = nullptr;
+    m_assetBus = nullptr;
+    UnbindResident();
+
+    //Play requests get queued until the samples are loaded again.
+    m_currentAsset = AZ::Data::Asset<AZ::Data::AssetData>();
+}
+
+void SoundPlayer::UnbindResident()
+{
+    if (!m_residentAsset)
+    {
+        return;
+    }
+
+    if (SoundMemoryManager* memoryManager = SoundMemoryManagerInterface::Get())
+    {
+        memoryManager->Unbind(*m_residentAsset);
+    }
+    m_residentAsset = AZ::Data::Asset<AZ::Data::AssetData>();
+}
+
+void SoundPlayer::UpdateResidency(SoundMemoryManager& memoryManager)
+{
+    if (m_residentAsset)
+    {
+        if (IsPlaying())
+        {
+            memoryManager.Touch(*m_residentAsset);
+        }
+        else if (memoryManager.IsEvicting(*m_residentAsset))
+        {
+            ReleaseResident();
+        }
+    }
+    else if (!m_schedPlayEvents.empty() && m_pendingAsset.IsReady() && m_pendingAsset.GetId() == m_assetId
+        && memoryManager.IsResident(*m_pendingAsset))
+    {
+        //Loaded again, play whatever was queued while it was gone.
+        OnAssetReady(m_pendingAsset);
+    }
 }
 
 bool SoundPlayer::IsPlaying()
 {
+    if (m_source)
+    {
+        return m_sourceNode->playbackState() == lab::SchedulingState::PLAYING
+            || m_sourceNode->playbackState() == lab::SchedulingState::SCHEDULED;
+    }
+
     if (m_node->playbackState() == lab::SchedulingState::PLAYING
         || m_node->playbackState() == lab::SchedulingState::SCHEDULED)
     {
@@ -293,6 +496,11 @@ float SoundPlayer::GetPositionInSeconds()
         return 0;
     }
 
+    if (m_source)
+    {
+        return static_cast<float>(m_source->GetCursor()) / m_source->GetSampleRate();
+    }
+
     int32_t sampleCursor = -1;
     {
         auto ctx = SuneInterface::Get()->GetLabContext();
@@ -321,6 +529,12 @@ uint64_t SoundPlayer::GetPositionInMicroseconds()
         return 0;
     }
 
+    if (m_source)
+    {
+        const double micros = (static_cast<double>(m_source->GetCursor()) / m_source->GetSampleRate()) * 1'000'000.0;
+        return static_cast<uint64_t>(micros);
+    }
+
     int32_t sampleCursor = -1;
     {
         auto ctx = SuneInterface::Get()->GetLabContext();
@@ -407,19 +621,45 @@ void SoundPlayer::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
         AZ_Error("Sune", false, "Failed to load asset %s\n", asset.GetId().ToString<AZStd::string>().c_str());
         return;
     }
-    m_assetBus = soundAsset->m_bus;
+    auto ctx = SuneInterface::Get()->GetLabContext();
+    m_node->clearPlayback();
+    m_sourceNode->stop(0.0);
+
+    UnbindResident();
+    m_assetGain = SuneInterface::Get()->GetAssetGain(*soundAsset);
+    m_gainNode->gain()->setValue(m_gain * m_assetGain);
+    m_source = CreateSoundSource(SoundDataAsset(asset), ctx->sampleRate());
+    m_sourceNode->SetSource(*ctx, m_source);
+    m_assetBus = m_source ? nullptr : soundAsset->m_bus;
 
     m_node->setBus(m_assetBus);
     ReconnectGraph();
 
+    if (m_source || m_assetBus)
+    {
+        m_residentAsset = asset;
+        if (SoundMemoryManager* memoryManager = SoundMemoryManagerInterface::Get())
+        {
+            memoryManager->Bind(*m_residentAsset);
+        }
+    }
+
     //Good!
     AZ::Data::AssetBus::MultiHandler::BusDisconnect(m_assetId);
+    m_loadTicket = InvalidSoundLoadTicket;
     m_currentAsset = asset;
 
     //Handled schedualed playbacks
-    if (!m_schedPlayEvents.empty())
+    if (!m_schedPlayEvents.empty() && m_source)
+    {
+        for (auto& sched : m_schedPlayEvents)
+        {
+            StartSource(ctx->currentTime() - sched.seconds, sched.loopCount);
+        }
+        m_schedPlayEvents.clear();
+    }
+    else if (!m_schedPlayEvents.empty())
     {
-        auto ctx = SuneInterface::Get()->GetLabContext();
         if (m_canPlayMultiple)
         {
             for ([[maybe_unused]]auto& sched : m_schedPlayEvents)
@@ -438,6 +678,15 @@ void SoundPlayer::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
     }
 }
 
+std::shared_ptr<lab::AudioNode> SoundPlayer::GetPlaybackNode() const
+{
+    if (m_source)
+    {
+        return m_sourceNode;
+    }
+    return m_node;
+}
+
 static void DisconnectAll(lab::ContextGraphLock* l, bool bIsInput, lab::AudioNode* node)
 {
     lab::ContextRenderLock rl(l->context(), "DisconnectAll");
@@ -467,9 +716,9 @@ static void DisconnectAll(lab::ContextGraphLock* l, bool bIsInput, lab::AudioNod
 
 void SoundPlayer::ReconnectGraph()
 {
-    if (m_assetBus == nullptr)
+    if (m_assetBus == nullptr && m_source == nullptr)
     {
-        //sample player needs a bus first to be properly connected.
+        //sample player needs a bus or a source first to be properly connected.
         return;
     }
 
@@ -487,6 +736,11 @@ void SoundPlayer::ReconnectGraph()
             DisconnectAll(&r, false, m_node.get());
         }
 
+        if (m_sourceNode != nullptr)
+        {
+            DisconnectAll(&r, false, m_sourceNode.get());
+        }
+
         //Disconnect all inputs from gain (our main output node)
         if (m_gainNode)
         {
@@ -518,7 +772,7 @@ void SoundPlayer::ReconnectGraph()
                           return a->GetProcessingOrder() < b->GetProcessingOrder();
                       });
 
-    std::shared_ptr<lab::AudioNode> currentOutput = m_node;
+    std::shared_ptr<lab::AudioNode> currentOutput = GetPlaybackNode();
 
     // Connect through each effect
     for (auto* effect : enabledEffects)
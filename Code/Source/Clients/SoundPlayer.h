@@ -13,6 +13,7 @@
 #include "Sune/AudioBusManagerInterface.h"
 #include "Sune/PlayerAudioEffect.h"
 #include "Sune/SuneBus.h"
+#include "SoundLoadScheduler.h"
 
 namespace lab
 {
@@ -28,6 +29,9 @@ namespace lab
 namespace Sune
 {
     class SoundAsset;
+    class SoundMemoryManager;
+    class SoundSource;
+    class SoundSourceNode;
 
     struct PlaybackEvent
     {
@@ -47,6 +51,9 @@ namespace Sune
         std::shared_ptr<lab::AudioBus> GetAudioBus() const { return m_assetBus; }
         std::shared_ptr<lab::SampledAudioNode> GetNode() const { return m_node; }
 
+        //Keeps the asset's samples marked as used while playing, and lets go of them once they get evicted.
+        void UpdateResidency(SoundMemoryManager& memoryManager);
+
     protected:
         //PlayerRequests
         void SetBus(const AZStd::string& bus) override;
@@ -54,6 +61,8 @@ namespace Sune
         void SetAsset(const AZ::Data::AssetId assetId) override;
         AZ::Data::AssetId GetAsset() override;
 
+        void SetLoadPriority(SoundLoadPriority priority) override;
+
         void SetPlayMultiple(bool canPlayMultiple) override;
 
         void SetGain(float gain) override;
@@ -84,6 +93,17 @@ namespace Sune
     private:
         friend class SuneSystemComponent;
         void ReconnectGraph();
+        //The node that currently feeds the graph, the source node for streamed assets.
+        std::shared_ptr<lab::AudioNode> GetPlaybackNode() const;
+        void StartSource(double offsetSeconds, int loopCount);
+        //Moves a fast start asset over to its bus once the tail is decoded and nothing is playing from the source.
+        void SwitchToBusOnceDecoded();
+        //Gets evicted samples back before playing, queued play events run once they are.
+        void RequestResident();
+        void ReleaseResident();
+        void UnbindResident();
+        //Lets the scheduler drop a load we asked for that hasn't been needed since.
+        void CancelLoad();
 
         SoundPlayerId m_id = SoundPlayerId();
         AudioBusId m_busId = InvalidAudioBusId;
@@ -91,15 +111,28 @@ namespace Sune
         AZ::Data::AssetId m_assetId = {};
         AZ::Data::Asset<Sune::SoundAsset> m_currentAsset = {};
         AZ::Data::Asset<Sune::SoundAsset> m_pendingAsset = {};
+        SoundLoadPriority m_loadPriority = SoundLoadPriority::Nearby;
+        SoundLoadTicket m_loadTicket = InvalidSoundLoadTicket;
         std::shared_ptr<lab::AudioBus> m_assetBus = {};
         AZStd::vector<PlaybackEvent> m_schedPlayEvents = {};
 
         //Known static nodes in the SoundPlayer graph
         std::shared_ptr<lab::SampledAudioNode> m_node = nullptr;
         std::shared_ptr<lab::GainNode> m_gainNode = nullptr;
+        std::shared_ptr<SoundSourceNode> m_sourceNode = nullptr;
+
+        //Set instead of m_assetBus when the asset is rendered by a SoundSource.
+        std::shared_ptr<SoundSource> m_source = nullptr;
+
+        //The asset whose samples our nodes reference, bound with the SoundMemoryManager.
+        AZ::Data::Asset<Sune::SoundAsset> m_residentAsset = {};
 
         AZStd::vector<AZStd::unique_ptr<IPlayerAudioEffect>> m_effects;
 
+        //The gain node plays at both, set by SetGain and by the asset.
+        float m_gain = 1.0f;
+        float m_assetGain = 1.0f;
+
         bool m_canPlayMultiple = true;
         bool m_gainConnected = false;
     };
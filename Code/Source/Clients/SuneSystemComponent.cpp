@@ -14,6 +14,8 @@
 #include <LabSound/backends/AudioDevice_Miniaudio.h>
 
 #include "SoundAssetHandler.h"
+#include "SoundBankAssetHandler.h"
+#include "SampleAllocator.h"
 #include "AzCore/Math/Sfmt.h"
 #include "AzCore/Settings/SettingsRegistry.h"
 #include "AzCore/std/smart_ptr/make_shared.h"
@@ -26,6 +28,7 @@
 #include <AzCore/std/function/function_template.h>
 
 #include "Effects/LabHrtfEffect.h"
+#include "Playback/RenderEpochNode.h"
 #include "Effects/RadioEffect.h"
 #include "Effects/VisualizerEffect.h"
 #include "Sune/AudioPlayerBus.h"
@@ -38,6 +41,7 @@ namespace Sune
     void SuneSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SoundAsset::Reflect(context);
+        SoundBankAsset::Reflect(context);
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<SuneSystemComponent, AZ::Component>()
@@ -57,6 +61,15 @@ namespace Sune
                 ->Attribute(AZ::Script::Attributes::Module, "Sune")
                 ->Event("CreatePlayer", &SuneRequestBus::Events::CreatePlayer)
                 ->Event("DestroyPlayer", &SuneRequestBus::Events::DestroyPlayer)
+                ->Event("LoadSoundBank", &SuneRequestBus::Events::LoadSoundBank,
+                    {{{"BankId", "Asset ID of the sound bank, its sounds play by their own asset ids once it's loaded."}}})
+                ->Event("UnloadSoundBank", &SuneRequestBus::Events::UnloadSoundBank)
+                ;
+
+            behaviorContext->Enum<static_cast<int>(SoundLoadPriority::Critical)>("SoundLoadPriority_Critical")
+                ->Enum<static_cast<int>(SoundLoadPriority::Nearby)>("SoundLoadPriority_Nearby")
+                ->Enum<static_cast<int>(SoundLoadPriority::Ambience)>("SoundLoadPriority_Ambience")
+                ->Enum<static_cast<int>(SoundLoadPriority::Prefetch)>("SoundLoadPriority_Prefetch")
                 ;
 
             behaviorContext->EBus<SoundPlayerRequestBus>("TuSoundPlayerRequestBus")
@@ -67,6 +80,8 @@ namespace Sune
                 ->Event("SetAsset", &SoundPlayerRequestBus::Events::SetAsset,
                     {{{"AssetId", "Asset ID of the sound file to load and play."}}})
                 ->Event("GetAsset", &SoundPlayerRequestBus::Events::GetAsset)
+                ->Event("SetLoadPriority", &SoundPlayerRequestBus::Events::SetLoadPriority,
+                    {{{"Priority", "How soon the asset loads when others are waiting, Critical loads straight away."}}})
                 // Playback Behavior
                 ->Event("SetPlayMultiple", &SoundPlayerRequestBus::Events::SetPlayMultiple,
                     {{{"CanPlayMultiple", "If false, the player will always stop what's currently playing and queue a new playback."}}})
@@ -220,6 +235,7 @@ namespace Sune
 
         const lab::AudioDeviceInfo* defaultOutput = nullptr;
         const lab::AudioDeviceInfo* defaultInput = nullptr;
+        float outputSampleRate = 0.0f;
 
         if (bEnableOutput)
         {
@@ -256,6 +272,7 @@ namespace Sune
             config.desired_channels = 2;
             config.device_index = defaultOutput->index;
             config.desired_samplerate = defaultOutput->nominal_samplerate;
+            outputSampleRate = defaultOutput->nominal_samplerate;
 
             if (defaultInput != nullptr)
             {
@@ -275,11 +292,74 @@ namespace Sune
             m_context->setDestinationNode(m_destination);
         }
 
+        //Released sample memory waits here until the render thread is done with it.
+        m_graveyard = AZStd::make_unique<SampleGraveyard>(m_device != nullptr);
+        if (m_device)
+        {
+            m_epochNode = std::make_shared<RenderEpochNode>(*m_context, *m_graveyard);
+            m_context->addAutomaticPullNode(m_epochNode);
+        }
+
         m_context->synchronizeConnections();
 
         //TODO: Make a patch to LabSound to support a custom loader so we can use the Asset System.
         // m_context->loadHrtfDatabase("/home/drogonmar/Desktop/LabSound/assets/hrtf");
 
+        m_streamer = AZStd::make_unique<SoundStreamer>();
+
+        bool bEnableDecodeCache = false;
+        AZ::u64 decodeCacheSizeMB = DecodeCache::DefaultMaxSizeMB;
+        AZStd::string decodeCachePath = "@user@/Sune/DecodeCache";
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(bEnableDecodeCache, "/Audio/DecodeCache/Enabled");
+            settingsRegistry->Get(decodeCacheSizeMB, "/Audio/DecodeCache/MaxSizeMB");
+            settingsRegistry->Get(decodeCachePath, "/Audio/DecodeCache/Path");
+        }
+        if (bEnableDecodeCache)
+        {
+            m_decodeCache = AZStd::make_unique<DecodeCache>(decodeCachePath.c_str(), decodeCacheSizeMB * 1024 * 1024);
+        }
+
+        //Platforms set their own budget in Registry/Platform, no budget keeps everything resident.
+        AZ::u64 memoryBudgetMB = 0;
+        double memoryIdleSeconds = SoundMemoryManager::DefaultIdleSeconds;
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(memoryBudgetMB, "/Audio/MemoryBudgetMB");
+            settingsRegistry->Get(memoryIdleSeconds, "/Audio/MemoryIdleSeconds");
+        }
+        m_memoryManager = AZStd::make_unique<SoundMemoryManager>(memoryBudgetMB * 1024 * 1024, static_cast<float>(memoryIdleSeconds));
+        m_sharedSamples = AZStd::make_unique<SharedSampleRegistry>();
+
+        //Loads past the limit wait their turn by priority, so decodes don't crowd out rendering and streaming I/O.
+        AZ::u64 maxConcurrentLoads = SoundLoadScheduler::DefaultMaxConcurrentLoads;
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(maxConcurrentLoads, "/Audio/MaxConcurrentLoads");
+        }
+        m_loadScheduler = AZStd::make_unique<SoundLoadScheduler>(static_cast<AZ::u32>(maxConcurrentLoads));
+
+        //Resident samples built at another rate can be resampled once on load rather than by every voice that plays them.
+        bool bResampleOnLoad = false;
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(bResampleOnLoad, "/Audio/ResampleOnLoad");
+        }
+        SoundAssetHandler::SetLoadSampleRate(bResampleOnLoad ? static_cast<int>(outputSampleRate) : 0);
+
+        //Players scale each asset to the same loudness using what the builder measured, rather than limiting the mix.
+        double targetLoudness = DefaultTargetLoudness;
+        double maxTruePeak = DefaultMaxTruePeak;
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(m_normalizeLoudness, "/Audio/Loudness/Normalize");
+            settingsRegistry->Get(targetLoudness, "/Audio/Loudness/TargetLUFS");
+            settingsRegistry->Get(maxTruePeak, "/Audio/Loudness/MaxTruePeak");
+        }
+        m_targetLoudness = static_cast<float>(targetLoudness);
+        m_maxTruePeak = static_cast<float>(maxTruePeak);
+
         m_busManager = AZStd::make_shared<BusManager>();
 
         //create default bus
@@ -292,6 +372,14 @@ namespace Sune
             AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequests::AddExtension, SoundAsset::FileExtension);
             m_assetHandlers.emplace_back(handler);
         }
+
+        {
+            SoundBankAssetHandler* handler = aznew SoundBankAssetHandler();
+            AZ::Data::AssetCatalogRequestBus::Broadcast(
+                &AZ::Data::AssetCatalogRequests::EnableCatalogForAsset, AZ::AzTypeInfo<SoundBankAsset>::Uuid());
+            AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequests::AddExtension, SoundBankAsset::FileExtension);
+            m_assetHandlers.emplace_back(handler);
+        }
     }
 
     void SuneSystemComponent::Deactivate()
@@ -305,13 +393,30 @@ namespace Sune
         }
 
         m_players.clear();
+        m_loadScheduler.reset();
         m_busManager.reset();
 
+        m_soundBanks.clear();
         m_assetHandlers.clear();
+        m_memoryManager.reset();
+        m_sharedSamples.reset();
+
+        if (m_epochNode)
+        {
+            m_context->removeAutomaticPullNode(m_epochNode);
+            m_epochNode.reset();
+        }
 
         m_destination.reset();
         m_context.reset();
         m_device.reset();
+
+        //Nothing renders any more, whatever is left can go.
+        m_graveyard.reset();
+
+        //Sources are gone with the players and context, nothing left to stream.
+        m_streamer.reset();
+        m_decodeCache.reset();
     }
 
     void SuneSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
@@ -328,16 +433,83 @@ namespace Sune
 
         listener->setForward(ToLab(forwardVector));
         listener->setUpVector(ToLab(upVector));
+
+        if (m_memoryManager && m_memoryManager->HasBudget())
+        {
+            for (auto& [id, player] : m_players)
+            {
+                player->UpdateResidency(*m_memoryManager);
+            }
+            m_memoryManager->Update();
+        }
+
+        if (m_graveyard)
+        {
+            m_graveyard->Collect();
+        }
+    }
+
+    void SuneSystemComponent::LoadSoundBank(const AZ::Data::AssetId& bankId)
+    {
+        if (m_soundBanks.contains(bankId))
+        {
+            return;
+        }
+
+        auto bank = AZ::Data::AssetManager::Instance().GetAsset<SoundBankAsset>(bankId, AZ::Data::AssetLoadBehavior::PreLoad);
+        if (!bank)
+        {
+            AZ_Error("Sune", false, "Failed to load sound bank %s", bankId.ToString<AZStd::string>().c_str());
+            return;
+        }
+        m_soundBanks[bankId] = bank;
+    }
+
+    void SuneSystemComponent::UnloadSoundBank(const AZ::Data::AssetId& bankId)
+    {
+        //Players keep the members they are using alive.
+        m_soundBanks.erase(bankId);
+    }
+
+    SoundDataAsset SuneSystemComponent::FindSoundBankMember(const AZ::Data::AssetId& assetId) const
+    {
+        for (const auto& [bankId, bank] : m_soundBanks)
+        {
+            if (bank.IsReady())
+            {
+                if (SoundDataAsset member = bank->FindMember(assetId))
+                {
+                    return member;
+                }
+            }
+        }
+        return {};
+    }
+
+    SoundMemoryStats SuneSystemComponent::GetSoundMemoryStats() const
+    {
+        SoundMemoryStats stats = m_memoryManager ? m_memoryManager->GetStats() : SoundMemoryStats();
+        stats.m_pendingReleaseBytes = m_graveyard ? m_graveyard->GetPendingBytes() : 0;
+        return stats;
+    }
+
+    float SuneSystemComponent::GetAssetGain(const SoundAsset& asset) const
+    {
+        return m_normalizeLoudness ? asset.GetNormalizedGain(m_targetLoudness, m_maxTruePeak) : asset.m_volume;
     }
 
     static bool g_igShowPlayers = false;
     static bool g_igShowLabSoundBus = false;
+    static bool g_igShowDecodeCache = false;
+    static bool g_igShowMemory = false;
     void SuneSystemComponent::OnImGuiMainMenuUpdate()
     {
         if (ImGui::BeginMenu("Sune"))
         {
             ImGui::MenuItem("SoundPlayers", nullptr, &g_igShowPlayers);
             ImGui::MenuItem("Bus", nullptr, &g_igShowLabSoundBus);
+            ImGui::MenuItem("Decode Cache", nullptr, &g_igShowDecodeCache);
+            ImGui::MenuItem("Memory", nullptr, &g_igShowMemory);
             ImGui::EndMenu();
         }
     }
@@ -633,5 +805,85 @@ namespace Sune
             }
             ImGui::End();
         }
+
+        if (g_igShowDecodeCache)
+        {
+            if (ImGui::Begin("Sune Decode Cache"))
+            {
+                if (m_decodeCache)
+                {
+                    const DecodeCacheStats stats = m_decodeCache->GetStats();
+                    const AZ::u64 lookups = stats.m_hits + stats.m_misses;
+                    ImGui::Text("Hits: %llu", stats.m_hits);
+                    ImGui::Text("Misses: %llu", stats.m_misses);
+                    ImGui::Text("Hit Rate: %.1f%%", lookups > 0 ? 100.0 * stats.m_hits / lookups : 0.0);
+                    ImGui::Text("Stores: %llu", stats.m_stores);
+                    ImGui::Text("Evictions: %llu", stats.m_evictions);
+                    ImGui::Text("Size: %.1f / %.1f MB", stats.m_sizeBytes / (1024.0 * 1024.0), stats.m_maxSizeBytes / (1024.0 * 1024.0));
+                }
+                else
+                {
+                    ImGui::Text("Disabled, set /Audio/DecodeCache/Enabled to turn it on.");
+                }
+            }
+            ImGui::End();
+        }
+
+        if (g_igShowMemory)
+        {
+            if (ImGui::Begin("Sune Memory"))
+            {
+                const SoundMemoryStats stats = GetSoundMemoryStats();
+                ImGui::Text("Resident: %.1f MB in %u assets", stats.m_residentBytes / (1024.0 * 1024.0), stats.m_residentAssets);
+                ImGui::Text("Saved By Sharing: %.1f MB", stats.m_sharedBytes / (1024.0 * 1024.0));
+                if (stats.m_budgetBytes > 0)
+                {
+                    ImGui::Text("Budget: %.1f MB", stats.m_budgetBytes / (1024.0 * 1024.0));
+                }
+                else
+                {
+                    ImGui::Text("Budget: Unlimited");
+                }
+                ImGui::Text("Evictions: %llu", stats.m_evictions);
+                ImGui::Text("Reloads: %llu", stats.m_reloads);
+                ImGui::Text("Waiting On Render Thread: %.1f MB", stats.m_pendingReleaseBytes / (1024.0 * 1024.0));
+
+                const SampleAllocatorStats allocatorStats = SampleAllocator::Get().GetStats();
+                ImGui::Separator();
+                ImGui::Text("Slabs: %u (%u on large pages), %.1f of %.1f MB used", allocatorStats.m_slabs, allocatorStats.m_largePageSlabs,
+                    allocatorStats.m_slabUsedBytes / (1024.0 * 1024.0), allocatorStats.m_slabBytes / (1024.0 * 1024.0));
+                ImGui::Text("Long Sounds: %.1f MB in %u", allocatorStats.m_largeBytes / (1024.0 * 1024.0), allocatorStats.m_largeAllocations);
+                if (ImGui::BeginTable("SampleGroups", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                {
+                    ImGui::TableSetupColumn("Group");
+                    ImGui::TableSetupColumn("MB");
+                    ImGui::TableSetupColumn("Peak MB");
+                    ImGui::TableSetupColumn("Buffers");
+                    ImGui::TableHeadersRow();
+                    for (const SampleGroupStats& group : SampleAllocator::Get().GetGroupStats())
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(group.m_name.empty() ? "(No preset)" : group.m_name.c_str());
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.2f", group.m_bytes / (1024.0 * 1024.0));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%.2f", group.m_peakBytes / (1024.0 * 1024.0));
+                        ImGui::TableNextColumn();
+                        ImGui::Text("%u", group.m_allocations);
+                    }
+                    ImGui::EndTable();
+                }
+
+                if (m_loadScheduler)
+                {
+                    ImGui::Separator();
+                    ImGui::Text("Loading: %u", m_loadScheduler->GetLoadingCount());
+                    ImGui::Text("Waiting To Load: %u", m_loadScheduler->GetQueuedCount());
+                    ImGui::Text("Cancelled Loads: %llu", m_loadScheduler->GetCancelledCount());
+                }
+            }
+            ImGui::End();
+        }
     }
 } // namespace Sune
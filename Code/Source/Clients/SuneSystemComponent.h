@@ -9,9 +9,16 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <Sune/SuneBus.h>
+#include <Sune/SoundBankAsset.h>
 #include <Sune/AudioBusManagerInterface.h>
 
 #include "BusManager.h"
+#include "DecodeCache.h"
+#include "SampleGraveyard.h"
+#include "SharedSampleRegistry.h"
+#include "SoundLoadScheduler.h"
+#include "SoundMemoryManager.h"
+#include "Playback/SoundStreamer.h"
 #include "ImGuiBus.h"
 #include "AzCore/Asset/AssetCommon.h"
 
@@ -29,6 +36,7 @@ namespace lab
 
 namespace Sune
 {
+    class RenderEpochNode;
     class SoundPlayer;
     class SuneSystemComponent
         : public AZ::Component
@@ -40,6 +48,10 @@ namespace Sune
     public:
         AZ_COMPONENT_DECL(SuneSystemComponent);
 
+        //EBU R128 programme loudness, and enough headroom below full scale that nothing needs limiting.
+        static constexpr float DefaultTargetLoudness = -23.0f;
+        static constexpr float DefaultMaxTruePeak = -1.0f;
+
         static void Reflect(AZ::ReflectContext* context);
 
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
@@ -70,6 +82,14 @@ namespace Sune
         {
             return m_periodSizeInFrames;
         }
+
+        void LoadSoundBank(const AZ::Data::AssetId& bankId) override;
+        void UnloadSoundBank(const AZ::Data::AssetId& bankId) override;
+        SoundDataAsset FindSoundBankMember(const AZ::Data::AssetId& assetId) const override;
+
+        SoundMemoryStats GetSoundMemoryStats() const override;
+
+        float GetAssetGain(const SoundAsset& asset) const override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
@@ -95,12 +115,24 @@ namespace Sune
         AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler>> m_assetHandlers = {};
 
         int m_periodSizeInFrames = 128;
+        //Loudness normalisation, off unless /Audio/Loudness/Normalize is set.
+        bool m_normalizeLoudness = false;
+        float m_targetLoudness = DefaultTargetLoudness;
+        float m_maxTruePeak = DefaultMaxTruePeak;
         std::shared_ptr<lab::AudioDevice> m_device = {};
         std::shared_ptr<lab::AudioContext> m_context = {};
         std::shared_ptr<lab::AudioDestinationNode> m_destination = {};
         AZStd::shared_ptr<BusManager> m_busManager = {};
+        AZStd::unique_ptr<SoundStreamer> m_streamer = {};
+        AZStd::unique_ptr<DecodeCache> m_decodeCache = {};
+        AZStd::unique_ptr<SoundMemoryManager> m_memoryManager = {};
+        AZStd::unique_ptr<SharedSampleRegistry> m_sharedSamples = {};
+        AZStd::unique_ptr<SoundLoadScheduler> m_loadScheduler = {};
+        AZStd::unique_ptr<SampleGraveyard> m_graveyard = {};
+        std::shared_ptr<RenderEpochNode> m_epochNode = {};
 
         AZStd::unordered_map<SoundPlayerId, AZStd::shared_ptr<SoundPlayer>> m_players = {};
+        AZStd::unordered_map<AZ::Data::AssetId, SoundBankDataAsset> m_soundBanks = {};
     };
 
 } // namespace Sune
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include <Sune/WaveformPeaks.h>
+
+#include "MappedFile.h"
+
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/IO/FileIO.h>
+
+using namespace Sune;
+
+AZStd::unique_ptr<WaveformPeaks> WaveformPeaks::Open(const char* path)
+{
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    AZ::u64 size = 0;
+    if (fileIO == nullptr || !fileIO->Size(path, size) || size < sizeof(WaveformHeader))
+    {
+        return nullptr;
+    }
+
+    AZStd::unique_ptr<WaveformPeaks> peaks(aznew WaveformPeaks());
+    char resolvedPath[AZ_MAX_PATH_LEN] = {};
+    if (fileIO->ResolvePath(path, resolvedPath, sizeof(resolvedPath)))
+    {
+        peaks->m_mappedFile = MappedFile::Open(resolvedPath, 0, size);
+    }
+
+    if (peaks->m_mappedFile)
+    {
+        peaks->m_data = static_cast<const AZ::u8*>(peaks->m_mappedFile->GetData());
+    }
+    else
+    {
+        AZ::IO::FileIOStream file(path, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        peaks->m_fileData.resize_no_construct(size);
+        if (!file.IsOpen() || file.Read(size, peaks->m_fileData.data()) != size)
+        {
+            return nullptr;
+        }
+        peaks->m_data = peaks->m_fileData.data();
+    }
+
+    if (!peaks->Validate(size))
+    {
+        AZ_Warning("WaveformPeaks", false, "'%s' isn't a valid waveform peaks file.", path);
+        return nullptr;
+    }
+    return peaks;
+}
+
+AZStd::unique_ptr<WaveformPeaks> WaveformPeaks::OpenForSound(const AZ::Data::AssetId& soundAssetId)
+{
+    const AZ::Data::AssetId peaksId(soundAssetId.m_guid, AssetSubId);
+    AZ::Data::AssetInfo info;
+    AZ::Data::AssetCatalogRequestBus::BroadcastResult(info, &AZ::Data::AssetCatalogRequests::GetAssetInfoById, peaksId);
+    if (!info.m_assetId.IsValid())
+    {
+        return nullptr;
+    }
+    return Open(AZStd::string::format("@products@/%s", info.m_relativePath.c_str()).c_str());
+}
+
+WaveformPeaks::~WaveformPeaks() = default;
+
+const WaveformBin* WaveformPeaks::GetBins(AZ::u32 level) const
+{
+    return reinterpret_cast<const WaveformBin*>(m_data + m_levels[level].m_offset);
+}
+
+AZ::u32 WaveformPeaks::FindLevel(AZ::u64 maxBins) const
+{
+    for (AZ::u32 level = 0; level < m_header->m_levelCount; ++level)
+    {
+        if (m_levels[level].m_binCount <= maxBins)
+        {
+            return level;
+        }
+    }
+    return m_header->m_levelCount - 1;
+}
+
+bool WaveformPeaks::Validate(AZ::u64 size)
+{
+    m_header = reinterpret_cast<const WaveformHeader*>(m_data);
+    if (m_header->m_magic != WaveformHeader::Magic || m_header->m_version != WaveformHeader::Version
+        || m_header->m_channels == 0 || m_header->m_levelCount == 0
+        || sizeof(WaveformHeader) + m_header->m_levelCount * sizeof(WaveformLevel) > size)
+    {
+        return false;
+    }
+
+    m_levels = reinterpret_cast<const WaveformLevel*>(m_data + sizeof(WaveformHeader));
+    for (AZ::u32 level = 0; level < m_header->m_levelCount; ++level)
+    {
+        const WaveformLevel& entry = m_levels[level];
+        if (entry.m_offset % alignof(WaveformBin) != 0
+            || entry.m_offset + static_cast<AZ::u64>(entry.m_binCount) * m_header->m_channels * sizeof(WaveformBin) > size)
+        {
+            return false;
+        }
+    }
+    return true;
+}
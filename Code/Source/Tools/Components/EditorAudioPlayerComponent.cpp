@@ -57,6 +57,11 @@ void EditorAudioPlayerComponent::Reflect(AZ::ReflectContext* context)
                 ->Attribute(Attributes::Step, 0.1f)
             ->DataElement(UIHandlers::Default, &AudioPlayerComponentConfig::m_loop, "Loop", "Whether to loop the audio.")
             ->DataElement(UIHandlers::Default, &AudioPlayerComponentConfig::m_autoPlay, "Auto Play", "Whether to play the audio automatically.")
+            ->DataElement(UIHandlers::ComboBox, &AudioPlayerComponentConfig::m_loadPriority, "Load Priority", "How soon the audio loads when other sounds are waiting to.")
+                ->EnumAttribute(SoundLoadPriority::Critical, "Critical")
+                ->EnumAttribute(SoundLoadPriority::Nearby, "Nearby")
+                ->EnumAttribute(SoundLoadPriority::Ambience, "Ambience")
+                ->EnumAttribute(SoundLoadPriority::Prefetch, "Prefetch")
         ;
 
     }
@@ -0,0 +1,210 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "DecodedSourceCache.h"
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <libnyquist/Common.h>
+
+#include <chrono>
+#include <filesystem>
+
+using namespace Sune;
+
+namespace
+{
+    constexpr AZ::u32 CacheFileMagic = 0x43525353; //"SSRC"
+    //Bump when libnyquist is updated, a different decoder may give different samples for the same bytes.
+    constexpr AZ::u32 CacheFileVersion = 1;
+    constexpr const char* EntryExtension = ".src";
+    constexpr const char* TempExtension = ".tmp";
+    //A temporary file this old was left by a builder that died mid write, nothing is going to rename it.
+    constexpr std::chrono::hours StaleTempAge{1};
+
+    //The interleaved samples follow straight after, in native byte order since the cache never leaves the machine.
+    struct CacheFileHeader
+    {
+        AZ::u32 m_magic = CacheFileMagic;
+        AZ::u32 m_version = CacheFileVersion;
+        AZ::s32 m_channels = 0;
+        AZ::s32 m_sampleRate = 0;
+        AZ::u64 m_sampleCount = 0;
+    };
+
+    //FileIO can read modification times but not set them, so those go through the resolved path.
+    bool GetFilesystemPath(const char* path, std::filesystem::path& fsPath)
+    {
+        char resolvedPath[AZ_MAX_PATH_LEN] = {};
+        if (!AZ::IO::FileIOBase::GetInstance()->ResolvePath(path, resolvedPath, sizeof(resolvedPath)))
+        {
+            return false;
+        }
+        fsPath = resolvedPath;
+        return true;
+    }
+}
+
+bool DecodedSourceCache::Load(const AZ::Uuid& sourceHash, nqr::AudioData& audioData)
+{
+    const AZStd::string path = GetEntryPath(sourceHash);
+    AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+    if (!file.IsOpen())
+    {
+        return false;
+    }
+
+    CacheFileHeader header;
+    if (file.Read(sizeof(header), &header) != sizeof(header) || header.m_magic != CacheFileMagic || header.m_version != CacheFileVersion
+        || header.m_channels <= 0 || header.m_sampleRate <= 0
+        || file.GetLength() != sizeof(header) + header.m_sampleCount * sizeof(float))
+    {
+        AZ_Warning("DecodedSourceCache", false, "Decoded source '%s' is out of date, dropping it.", path.c_str());
+        file.Close();
+        AZ::IO::FileIOBase::GetInstance()->Remove(path.c_str());
+        return false;
+    }
+
+    audioData.samples.resize(header.m_sampleCount);
+    const AZ::u64 dataSize = header.m_sampleCount * sizeof(float);
+    if (file.Read(dataSize, audioData.samples.data()) != dataSize)
+    {
+        AZ_Warning("DecodedSourceCache", false, "Failed to read decoded source '%s'.", path.c_str());
+        audioData.samples.clear();
+        return false;
+    }
+
+    audioData.channelCount = header.m_channels;
+    audioData.sampleRate = header.m_sampleRate;
+    audioData.lengthSeconds = static_cast<double>(header.m_sampleCount / header.m_channels) / header.m_sampleRate;
+
+    //Evict goes by modification time, bumping it on every hit keeps sources still being built in the cache.
+    std::filesystem::path fsPath;
+    if (GetFilesystemPath(path.c_str(), fsPath))
+    {
+        std::error_code error;
+        std::filesystem::last_write_time(fsPath, std::filesystem::file_time_type::clock::now(), error);
+    }
+    return true;
+}
+
+void DecodedSourceCache::Store(const AZ::Uuid& sourceHash, const nqr::AudioData& audioData, AZ::u64 maxSizeBytes)
+{
+    const AZ::u64 dataSize = audioData.samples.size() * sizeof(float);
+    if (dataSize == 0 || sizeof(CacheFileHeader) + dataSize > maxSizeBytes)
+    {
+        return;
+    }
+
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (fileIO == nullptr || !fileIO->CreatePath(Directory))
+    {
+        AZ_Warning("DecodedSourceCache", false, "Failed to create the decoded source cache at '%s'.", Directory);
+        return;
+    }
+
+    //Another platform's job got here first.
+    const AZStd::string path = GetEntryPath(sourceHash);
+    if (fileIO->Exists(path.c_str()))
+    {
+        return;
+    }
+
+    //Or is writing it right now, each writes its own temporary file and both hold the same samples, so whichever rename lands is fine.
+    const AZStd::string tempPath = AZStd::string::format("%s.%s%s", path.c_str(), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str(), TempExtension);
+    {
+        AZ::IO::FileIOStream file(tempPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!file.IsOpen())
+        {
+            AZ_Warning("DecodedSourceCache", false, "Failed to open '%s' for writing.", tempPath.c_str());
+            return;
+        }
+
+        CacheFileHeader header;
+        header.m_channels = audioData.channelCount;
+        header.m_sampleRate = audioData.sampleRate;
+        header.m_sampleCount = audioData.samples.size();
+        if (file.Write(sizeof(header), &header) != sizeof(header) || file.Write(dataSize, audioData.samples.data()) != dataSize)
+        {
+            AZ_Warning("DecodedSourceCache", false, "Failed to write decoded source '%s'.", tempPath.c_str());
+            file.Close();
+            fileIO->Remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    if (!fileIO->Rename(tempPath.c_str(), path.c_str()))
+    {
+        fileIO->Remove(tempPath.c_str());
+        return;
+    }
+
+    Evict(maxSizeBytes);
+}
+
+AZStd::string DecodedSourceCache::GetEntryPath(const AZ::Uuid& sourceHash)
+{
+    return AZStd::string::format("%s/%s%s", Directory, sourceHash.ToString<AZStd::string>(false, false).c_str(), EntryExtension);
+}
+
+void DecodedSourceCache::Evict(AZ::u64 maxSizeBytes)
+{
+    //Only runs after a store, which is rare next to the decode it saves, so the directory is just scanned.
+    //Entries are dropped least recently used first, Load bumps the modification time of every entry it reads.
+    AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+    AZStd::vector<AZStd::pair<AZ::u64, AZStd::string>> entries;
+    AZ::u64 totalSize = 0;
+    const auto now = std::filesystem::file_time_type::clock::now();
+    fileIO->FindFiles(Directory, "*", [&](const char* path)
+    {
+        AZStd::string name;
+        AZ::StringFunc::Path::GetFullFileName(path, name);
+        if (name.ends_with(TempExtension))
+        {
+            std::filesystem::path fsPath;
+            std::error_code error;
+            if (GetFilesystemPath(path, fsPath))
+            {
+                const auto modified = std::filesystem::last_write_time(fsPath, error);
+                if (!error && now - modified > StaleTempAge)
+                {
+                    fileIO->Remove(path);
+                }
+            }
+        }
+        else if (name.ends_with(EntryExtension))
+        {
+            AZ::u64 size = 0;
+            fileIO->Size(path, size);
+            totalSize += size;
+            entries.emplace_back(fileIO->ModificationTime(path), path);
+        }
+        return true;
+    });
+
+    if (totalSize <= maxSizeBytes)
+    {
+        return;
+    }
+
+    AZStd::sort(entries.begin(), entries.end());
+    for (const auto& [modified, path] : entries)
+    {
+        if (totalSize <= maxSizeBytes)
+        {
+            break;
+        }
+
+        AZ::u64 size = 0;
+        fileIO->Size(path.c_str(), size);
+        if (fileIO->Remove(path.c_str()))
+        {
+            totalSize -= size;
+        }
+    }
+}
@@ -0,0 +1,40 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/string/string.h>
+
+namespace nqr
+{
+    struct AudioData;
+}
+
+namespace Sune
+{
+    //Sources as libnyquist decoded them, shared by every platform's job for a sound so each source is only decoded once per change.
+    //Entries are keyed by a hash of the source bytes and hold the decode before any preset is applied.
+    //Jobs can run in separate builder processes, so entries are written under a temporary name and renamed into place.
+    //The least recently used entries are removed once the cache grows past MaxSizeMB, along with temporary files a crashed job left behind.
+    class DecodedSourceCache
+    {
+    public:
+        static constexpr const char* Directory = "@user@/Sune/DecodedSources";
+        static constexpr AZ::u64 MaxSizeMB = 4096;
+
+        //Fills audioData from the entry for sourceHash, false if there isn't one.
+        static bool Load(const AZ::Uuid& sourceHash, nqr::AudioData& audioData);
+        //Tests pass a smaller maxSizeBytes to see entries evicted without writing gigabytes.
+        static void Store(const AZ::Uuid& sourceHash, const nqr::AudioData& audioData, AZ::u64 maxSizeBytes = MaxSizeMB * 1024 * 1024);
+
+        //The entry for sourceHash under Directory, whether or not it exists.
+        static AZStd::string GetEntryPath(const AZ::Uuid& sourceHash);
+
+    private:
+        static void Evict(AZ::u64 maxSizeBytes);
+    };
+}
@@ -0,0 +1,281 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "LoudnessMeter.h"
+
+#include "Clients/Resampler.h"
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <cmath>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace Sune;
+
+namespace
+{
+    constexpr double Pi = 3.14159265358979323846;
+    //BS.1770 offset so a 1kHz sine at 0dBFS reads -3.01 LUFS.
+    constexpr double LoudnessOffset = -0.691;
+    //True peak is oversampled this many output frames at a time rather than a whole channel at once.
+    constexpr size_t TruePeakChunkFrames = 4096;
+
+    struct Biquad
+    {
+        double m_b[3] = {};
+        double m_a[3] = {};
+    };
+
+    //The two K-weighting stages, derived for any rate rather than using the 48kHz coefficients from the spec.
+    Biquad MakeHighShelf(int sampleRate)
+    {
+        const double f0 = 1681.974450955533;
+        const double gain = 3.999843853973347;
+        const double q = 0.7071752369554196;
+
+        const double k = std::tan(Pi * f0 / sampleRate);
+        const double vh = std::pow(10.0, gain / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+        const double a0 = 1.0 + k / q + k * k;
+
+        Biquad biquad;
+        biquad.m_b[0] = (vh + vb * k / q + k * k) / a0;
+        biquad.m_b[1] = 2.0 * (k * k - vh) / a0;
+        biquad.m_b[2] = (vh - vb * k / q + k * k) / a0;
+        biquad.m_a[0] = 1.0;
+        biquad.m_a[1] = 2.0 * (k * k - 1.0) / a0;
+        biquad.m_a[2] = (1.0 - k / q + k * k) / a0;
+        return biquad;
+    }
+
+    Biquad MakeHighPass(int sampleRate)
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+
+        const double k = std::tan(Pi * f0 / sampleRate);
+        const double a0 = 1.0 + k / q + k * k;
+
+        Biquad biquad;
+        biquad.m_b[0] = 1.0;
+        biquad.m_b[1] = -2.0;
+        biquad.m_b[2] = 1.0;
+        biquad.m_a[0] = 1.0;
+        biquad.m_a[1] = 2.0 * (k * k - 1.0) / a0;
+        biquad.m_a[2] = (1.0 - k / q + k * k) / a0;
+        return biquad;
+    }
+
+    //Every sample depends on the last two outputs, so this part stays scalar.
+    void Filter(const Biquad& biquad, const float* in, size_t inStride, float* out, AZ::u64 frames)
+    {
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+        for (AZ::u64 i = 0; i < frames; ++i)
+        {
+            const double x = in[i * inStride];
+            const double y = biquad.m_b[0] * x + biquad.m_b[1] * x1 + biquad.m_b[2] * x2 - biquad.m_a[1] * y1 - biquad.m_a[2] * y2;
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            out[i] = static_cast<float>(y);
+        }
+    }
+
+    double SumOfSquares(const float* samples, AZ::u64 count)
+    {
+        AZ::u64 i = 0;
+        double sum = 0.0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //Summed in float a few thousand samples at a time, then carried over in double so long files don't lose precision.
+        constexpr AZ::u64 Chunk = 4096;
+        while (i + 8 <= count)
+        {
+            const AZ::u64 end = i + AZStd::min<AZ::u64>(Chunk, (count - i) & ~AZ::u64(7));
+            __m128 sum0 = _mm_setzero_ps();
+            __m128 sum1 = _mm_setzero_ps();
+            for (; i < end; i += 8)
+            {
+                const __m128 a = _mm_loadu_ps(samples + i);
+                const __m128 b = _mm_loadu_ps(samples + i + 4);
+                sum0 = _mm_add_ps(sum0, _mm_mul_ps(a, a));
+                sum1 = _mm_add_ps(sum1, _mm_mul_ps(b, b));
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, _mm_add_ps(sum0, sum1));
+            sum += static_cast<double>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            sum += static_cast<double>(samples[i]) * samples[i];
+        }
+        return sum;
+    }
+
+    float PeakOf(const float* samples, AZ::u64 count)
+    {
+        AZ::u64 i = 0;
+        float peak = 0.0f;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 peaks = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4)
+        {
+            peaks = _mm_max_ps(peaks, _mm_andnot_ps(signMask, _mm_loadu_ps(samples + i)));
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, peaks);
+        peak = AZStd::max(AZStd::max(lanes[0], lanes[1]), AZStd::max(lanes[2], lanes[3]));
+#endif
+        for (; i < count; ++i)
+        {
+            peak = AZStd::max(peak, std::fabs(samples[i]));
+        }
+        return peak;
+    }
+
+    //Surround channels count for more, LFE doesn't count at all. Anything that isn't 5.1 weights every channel the same.
+    double GetChannelWeight(int channel, int channels)
+    {
+        if (channels == 6)
+        {
+            constexpr double SurroundWeights[6] = {1.0, 1.0, 1.0, 0.0, 1.41, 1.41};
+            return SurroundWeights[channel];
+        }
+        return 1.0;
+    }
+
+    double ToLoudness(double meanSquare)
+    {
+        return LoudnessOffset + 10.0 * std::log10(meanSquare);
+    }
+}
+
+LoudnessMeasurement LoudnessMeter::Measure(const float* samples, int channels, int sampleRate, AZ::u64 frames)
+{
+    LoudnessMeasurement measurement;
+    measurement.m_integratedLoudness = AbsoluteGate;
+    if (channels <= 0 || sampleRate <= 0 || frames == 0)
+    {
+        return measurement;
+    }
+
+    const Biquad highShelf = MakeHighShelf(sampleRate);
+    const Biquad highPass = MakeHighPass(sampleRate);
+    const AZ::u64 stepFrames = AZStd::max<AZ::u64>(1, static_cast<AZ::u64>(sampleRate) * StepMilliseconds / 1000);
+    const AZ::u64 stepsPerBlock = BlockMilliseconds / StepMilliseconds;
+    const AZ::u64 steps = (frames + stepFrames - 1) / stepFrames;
+
+    //Weighted energy of every 100ms step, gating blocks are made of consecutive steps.
+    AZStd::vector<double> stepEnergy(steps, 0.0);
+
+    //True peak needs the waveform between samples, up to 4x oversampling finds it within a fraction of a dB.
+    //The stream carries the filter history between chunks so only a chunk is ever oversampled at once.
+    const AZ::u32 oversampling = sampleRate < 96000 ? 4 : 2;
+    const PolyphaseResampler oversampler(sampleRate, sampleRate * oversampling);
+    const AZ::u64 oversampledFrames = oversampler.GetOutputFrames(frames);
+    ResamplerStream oversampleStream(oversampler, TruePeakChunkFrames);
+    AZStd::vector<float> oversampled(TruePeakChunkFrames);
+    //Fed past the end, the same padding Process uses so the tail of the kernel is flushed.
+    const AZStd::vector<float> padding(oversampleStream.GetMaxInputFrames(), 0.0f);
+
+    AZStd::vector<float> shelved(frames);
+    AZStd::vector<float> weighted(frames);
+    float peak = 0.0f;
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        oversampleStream.Reset();
+        AZ::u64 pushed = 0;
+        for (AZ::u64 pulled = 0; pulled < oversampledFrames;)
+        {
+            const size_t chunk = static_cast<size_t>(AZStd::min<AZ::u64>(TruePeakChunkFrames, oversampledFrames - pulled));
+            const size_t needed = oversampleStream.GetInputFramesNeeded(chunk);
+            const size_t available = static_cast<size_t>(AZStd::min<AZ::u64>(needed, frames - AZStd::min(pushed, frames)));
+            if (available > 0)
+            {
+                oversampleStream.Push(samples + pushed * channels + ch, available, channels);
+            }
+            oversampleStream.Push(padding.data(), needed - available);
+            pushed += needed;
+
+            const size_t produced = oversampleStream.Pull(oversampled.data(), chunk);
+            peak = AZStd::max(peak, PeakOf(oversampled.data(), produced));
+            pulled += produced;
+        }
+
+        const double weight = GetChannelWeight(ch, channels);
+        if (weight == 0.0)
+        {
+            continue;
+        }
+
+        Filter(highShelf, samples + ch, channels, shelved.data(), frames);
+        Filter(highPass, shelved.data(), 1, weighted.data(), frames);
+        for (AZ::u64 s = 0; s < steps; ++s)
+        {
+            const AZ::u64 start = s * stepFrames;
+            stepEnergy[s] += weight * SumOfSquares(weighted.data() + start, AZStd::min(stepFrames, frames - start));
+        }
+    }
+    measurement.m_truePeak = peak > 0.0f ? 20.0f * std::log10(peak) : AbsoluteGate;
+
+    //Short sounds are a single block of whatever length they are.
+    AZStd::vector<double> blocks;
+    if (steps < stepsPerBlock)
+    {
+        double energy = 0.0;
+        for (double e : stepEnergy)
+        {
+            energy += e;
+        }
+        blocks.push_back(energy / static_cast<double>(frames));
+    }
+    else
+    {
+        const double blockFrames = static_cast<double>(stepFrames * stepsPerBlock);
+        for (AZ::u64 s = 0; s + stepsPerBlock <= steps; ++s)
+        {
+            double energy = 0.0;
+            for (AZ::u64 i = 0; i < stepsPerBlock; ++i)
+            {
+                energy += stepEnergy[s + i];
+            }
+            blocks.push_back(energy / blockFrames);
+        }
+    }
+
+    auto gatedMean = [&blocks](double threshold, double& mean)
+    {
+        double sum = 0.0;
+        size_t count = 0;
+        for (double block : blocks)
+        {
+            if (block > 0.0 && ToLoudness(block) > threshold)
+            {
+                sum += block;
+                ++count;
+            }
+        }
+        mean = count > 0 ? sum / static_cast<double>(count) : 0.0;
+        return count > 0;
+    };
+
+    double mean = 0.0;
+    if (!gatedMean(AbsoluteGate, mean))
+    {
+        return measurement;
+    }
+    const double relativeThreshold = AZStd::max<double>(ToLoudness(mean) + RelativeGate, AbsoluteGate);
+    if (gatedMean(relativeThreshold, mean))
+    {
+        measurement.m_integratedLoudness = static_cast<float>(ToLoudness(mean));
+    }
+    return measurement;
+}
@@ -0,0 +1,36 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace Sune
+{
+    struct LoudnessMeasurement
+    {
+        float m_integratedLoudness = 0.0f; //LUFS
+        float m_truePeak = 0.0f; //dBTP
+    };
+
+    //Integrated loudness and true peak after ITU-R BS.1770 / EBU R128, measured once by the builder.
+    //Sounds shorter than a gating block are measured as a single block rather than reported as unmeasurable,
+    //most effects are shorter than that.
+    class LoudnessMeter
+    {
+    public:
+        //Blocks quieter than this don't count, anything that never gets above it measures as silent.
+        static constexpr float AbsoluteGate = -70.0f;
+        //Blocks this far below the ungated loudness are left out too.
+        static constexpr float RelativeGate = -10.0f;
+        static constexpr int BlockMilliseconds = 400;
+        //Gating blocks overlap by 75%.
+        static constexpr int StepMilliseconds = 100;
+
+        //Interleaved float samples.
+        static LoudnessMeasurement Measure(const float* samples, int channels, int sampleRate, AZ::u64 frames);
+    };
+}
@@ -6,56 +6,49 @@
  */
 #include "SoundAssetBuilder.h"
 
+#include <cstring>
 #include <fstream>
 
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IOUtils.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include "Sune/SoundAsset.h"
+#include "Sune/WaveformPeaks.h"
 #include <libnyquist/Common.h>
 #include <libnyquist/Decoders.h>
 
 #include "AssetBuilderSDK/SerializationDependencies.h"
-#include "AzCore/Math/Random.h"
 
 //vorbis
 #include <vorbis/codec.h>
 #include <vorbis/vorbisfile.h>
 #include <vorbis/vorbisenc.h>
 
+#include <opus.h>
+
 #include "BuilderSettings/SoundAssetSettings.h"
 #include "BuilderSettings/SoundBuilderSettingsManager.h"
+#include "DecodedSourceCache.h"
+#include "LoudnessMeter.h"
+#include "WaveformPeaksBuilder.h"
+#include "Clients/Adpcm.h"
+#include "Clients/Decoders/OpusPacketDecoder.h"
+#include "Clients/Resampler.h"
+#include "Clients/SampleConversion.h"
 
 using namespace Sune;
 
-AZ::SimpleLcgRandom tuls_random;
-
 void SoundAssetBuilder::CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request,
     AssetBuilderSDK::CreateJobsResponse& response) const
 {
-	AssetBuilderSDK::SourceFileDependency globalConfigDep;
-    globalConfigDep.m_sourceFileDependencyPath = "@gemroot:Sune@/Config/SoundBuilder.json";
-    globalConfigDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute;
-
-	AssetBuilderSDK::SourceFileDependency globalProjectConfigDep;
-	globalProjectConfigDep.m_sourceFileDependencyPath = "@projectroot@/Config/SoundBuilder.json";
-    globalProjectConfigDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute;
-
-    response.m_sourceFileDependencyList.push_back(globalConfigDep);
-	response.m_sourceFileDependencyList.push_back(globalProjectConfigDep);
-
-	AssetBuilderSDK::SourceFileDependency presetDep;
-	presetDep.m_sourceFileDependencyPath = "@gemroot:Sune@/Config/Sune/*.preset";
-	presetDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Wildcards;
-	response.m_sourceFileDependencyList.push_back(presetDep);
-
-	AssetBuilderSDK::SourceFileDependency presetProjDep;
-	presetProjDep.m_sourceFileDependencyPath = "@projectroot@/Config/Sune/*.preset";
-	presetProjDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Wildcards;
-	response.m_sourceFileDependencyList.push_back(presetProjDep);
+	AddSettingsDependencies(response);
 
     for (const AssetBuilderSDK::PlatformInfo& platformInfo : request.m_enabledPlatforms)
     {
@@ -73,84 +66,18 @@ void SoundAssetBuilder::CreateJobs(const AssetBuilderSDK::CreateJobsRequest& req
 void SoundAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request,
     AssetBuilderSDK::ProcessJobResponse& response) const
 {
-	SoundBuilderSettingsManager* settingsManager = SoundBuilderSettingsManager::Get();
-	if (settingsManager == nullptr)
+	AZStd::vector<AZ::u8> rawAudioData;
+	AZStd::vector<AZ::u8> waveformPeaks;
+    AZ::Data::Asset<SoundAsset> soundAsset;
+    //Same id every build, nothing in the product may change unless the source or settings do.
+    soundAsset.Create(AZ::Data::AssetId(request.m_sourceFileUUID, SoundAsset::AssetSubId));
+
+	if (!BuildSound(request.m_fullPath, request.m_platformInfo.m_identifier, *soundAsset.Get(), rawAudioData, &waveformPeaks))
 	{
 		response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-		AZ_Error("SoundAssetBuilder", false, "Failed to get SoundBuilderSettingsManager.");
 		return;
 	}
 
-    const AZStd::string& fromFile = request.m_fullPath;
-
-	auto settings = settingsManager->GetSettings(fromFile, request.m_platformInfo.m_identifier);
-	AZ_Info("SoundAssetBuilder",
-		"Processing sound asset using preset '%s' quality: %.2f",
-		settings.m_presetName.c_str(), settings.m_quality);
-
-	AZStd::vector<AZ::u8> rawAudioData;
-    AZ::Data::Asset<SoundAsset> soundAsset;
-    soundAsset.Create(AZ::Data::AssetId(AZ::Uuid::CreateRandom()));
-
-    auto assetDataStream = AZStd::make_shared<AZ::Data::AssetDataStream>();
-    {
-		nqr::NyquistIO nyquist_io;
-
-        AZ::IO::FileIOStream stream(fromFile.c_str(), AZ::IO::OpenMode::ModeRead);
-        if (!AZ::IO::RetryOpenStream(stream))
-        {
-            AZ_Error("SoundAssetBuilder", false, "Source file '%s' could not be opened.", fromFile.c_str());
-            return;
-        }
-
-        AZStd::vector<AZ::u8> fileBuffer(stream.GetLength());
-        const size_t bytesRead = stream.Read(fileBuffer.size(), fileBuffer.data());
-        if (bytesRead != stream.GetLength())
-        {
-            AZ_Error("SoundAssetBuilder", false, "Source file '%s' could not be read.", fromFile.c_str());
-            return;
-        }
-
-    	auto audioData = AZStd::make_unique<nqr::AudioData>();
-    	nyquist_io.Load(audioData.get(), std::vector<uint8_t>{fileBuffer.data(), fileBuffer.data() + fileBuffer.size()});
-    	if (audioData->samples.empty())
-    	{
-    		AZ_Error("SoundAssetBuilder", false, "Failed to load audio data, failed to decode source.");
-    		return;
-    	}
-
-        soundAsset->m_importFormat = settings.m_format;
-    	soundAsset->m_loadMethod = settings.m_loadMethod;
-		soundAsset->m_channels = audioData->channelCount;
-		soundAsset->m_sampleRate = audioData->sampleRate;
-		soundAsset->m_totalSamples = audioData->samples.size();
-
-		if (settings.m_volumeAdjustment != 1.0f)
-		{
-			AZ_Warning("SoundAssetBuilder", false, "Volume adjustment isn't supported yet.");
-		}
-
-    	switch (soundAsset->m_importFormat)
-    	{
-    		case AudioImportFormat::OriginalFile:
-    			rawAudioData = AZStd::move(fileBuffer);
-    			break;
-    	case AudioImportFormat::Vorbis:
-    			rawAudioData = CompressVorbis(audioData.get(), settings);
-    			if (rawAudioData.empty())
-    			{
-    				AZ_Error("SoundAssetBuilder", false, "Failed to compress file '%s' to OGG Vorbis.", fromFile.c_str());
-    				response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-    				return;
-    			}
-    			break;
-    		default:
-    			AZ_Error("SoundAssetBuilder", false, "Unknown import format.");
-				response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-    			return;
-    	}
-    }
-
 	AZStd::string filename;
 	AzFramework::StringFunc::Path::GetFileName(request.m_sourceFile.c_str(), filename);
 
@@ -169,17 +96,9 @@ void SoundAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& req
 		return;
 	}
 
-	if (!AZ::Utils::SaveObjectToStream(dataStream, AZ::DataStream::ST_BINARY, soundAsset.Get()))
-	{
-		AZ_Error("SoundAssetBuilder", false, "Failed to save Sune metadata to file '%s'!", outputPath.c_str());
-		response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-		return;
-	}
-
-	size_t bytesWritten = dataStream.Write(rawAudioData.size(), rawAudioData.data());
-	if (bytesWritten != rawAudioData.size())
+	if (!WriteSoundProduct(dataStream, *soundAsset.Get(), rawAudioData))
 	{
-		AZ_Error("SoundAssetBuilder", false, "Failed to write raw audio data to file '%s'.", outputPath.c_str());
+		AZ_Error("SoundAssetBuilder", false, "Failed to write sound asset to file '%s'.", outputPath.c_str());
 		response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
 		return;
 	}
@@ -191,8 +110,57 @@ void SoundAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& req
 	{
 		AZ_Error("SoundAssetBuilder", false, "Failed to output product dependencies.");
 		response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+		return;
+	}
+
+	AddSettingsPathDependencies(soundJobProduct);
+	response.m_outputProducts.push_back(AZStd::move(soundJobProduct));
+
+	//Peaks go in a product of their own so tools can draw the sound without loading it.
+	AZStd::string peaksPath = outputPath;
+	AzFramework::StringFunc::Path::ReplaceExtension(peaksPath, WaveformPeaks::FileExtension);
+	AZ::IO::FileIOStream peaksStream(peaksPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+	if (!AZ::IO::RetryOpenStream(peaksStream) || peaksStream.Write(waveformPeaks.size(), waveformPeaks.data()) != waveformPeaks.size())
+	{
+		AZ_Error("SoundAssetBuilder", false, "Failed to write waveform peaks to file '%s'.", peaksPath.c_str());
+		response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+		return;
 	}
+	peaksStream.Close();
+
+	AssetBuilderSDK::JobProduct peaksJobProduct(peaksPath, azrtti_typeid<WaveformPeaks>(), WaveformPeaks::AssetSubId);
+	peaksJobProduct.m_dependenciesHandled = true;
+	response.m_outputProducts.push_back(AZStd::move(peaksJobProduct));
+
+	response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+}
+
+void SoundAssetBuilder::AddSettingsDependencies(AssetBuilderSDK::CreateJobsResponse& response)
+{
+	AssetBuilderSDK::SourceFileDependency globalConfigDep;
+    globalConfigDep.m_sourceFileDependencyPath = "@gemroot:Sune@/Config/SoundBuilder.json";
+    globalConfigDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute;
+
+	AssetBuilderSDK::SourceFileDependency globalProjectConfigDep;
+	globalProjectConfigDep.m_sourceFileDependencyPath = "@projectroot@/Config/SoundBuilder.json";
+    globalProjectConfigDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute;
+
+    response.m_sourceFileDependencyList.push_back(globalConfigDep);
+	response.m_sourceFileDependencyList.push_back(globalProjectConfigDep);
+
+	AssetBuilderSDK::SourceFileDependency presetDep;
+	presetDep.m_sourceFileDependencyPath = "@gemroot:Sune@/Config/Sune/*.preset";
+	presetDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Wildcards;
+	response.m_sourceFileDependencyList.push_back(presetDep);
+
+	AssetBuilderSDK::SourceFileDependency presetProjDep;
+	presetProjDep.m_sourceFileDependencyPath = "@projectroot@/Config/Sune/*.preset";
+	presetProjDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Wildcards;
+	response.m_sourceFileDependencyList.push_back(presetProjDep);
+}
 
+void SoundAssetBuilder::AddSettingsPathDependencies(AssetBuilderSDK::JobProduct& product)
+{
 	AZStd::vector<AZStd::string> configFiles = {
 		"@gemroot:Sune@/Config/SoundBuilder.json",
 		"@gemroot:Sune@/Config/Sune/*.preset",
@@ -205,20 +173,344 @@ void SoundAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& req
 		AssetBuilderSDK::ProductPathDependency dep;
 		dep.m_dependencyPath = configFile;
 		dep.m_dependencyType = AssetBuilderSDK::ProductPathDependencyType::SourceFile;
-		soundJobProduct.m_pathDependencies.emplace(dep);
+		product.m_pathDependencies.emplace(dep);
 	}
+}
 
-	response.m_outputProducts.push_back(AZStd::move(soundJobProduct));
+bool SoundAssetBuilder::BuildSound(const AZStd::string& fromFile, const AZStd::string& platform, SoundAsset& soundAsset,
+	AZStd::vector<AZ::u8>& rawAudioData, AZStd::vector<AZ::u8>* waveformPeaks) const
+{
+	SoundBuilderSettingsManager* settingsManager = SoundBuilderSettingsManager::Get();
+	if (settingsManager == nullptr)
+	{
+		AZ_Error("SoundAssetBuilder", false, "Failed to get SoundBuilderSettingsManager.");
+		return false;
+	}
 
-	response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+	auto settings = settingsManager->GetSettings(fromFile, platform);
+	AZ_Info("SoundAssetBuilder",
+		"Processing sound asset using preset '%s' quality: %.2f",
+		settings.m_presetName.c_str(), settings.m_quality);
+
+	nqr::NyquistIO nyquist_io;
+
+	AZ::IO::FileIOStream stream(fromFile.c_str(), AZ::IO::OpenMode::ModeRead);
+	if (!AZ::IO::RetryOpenStream(stream))
+	{
+		AZ_Error("SoundAssetBuilder", false, "Source file '%s' could not be opened.", fromFile.c_str());
+		return false;
+	}
+
+	//Read straight into the vector libnyquist takes, so the source is only ever held once.
+	std::vector<uint8_t> fileBuffer(stream.GetLength());
+	const size_t bytesRead = stream.Read(fileBuffer.size(), fileBuffer.data());
+	if (bytesRead != stream.GetLength())
+	{
+		AZ_Error("SoundAssetBuilder", false, "Source file '%s' could not be read.", fromFile.c_str());
+		return false;
+	}
+
+	//Every platform's job starts from the same decode, so it's cached for the jobs that come after.
+	const AZ::Uuid sourceHash = AZ::Uuid::CreateData(fileBuffer.data(), fileBuffer.size());
+	auto audioData = AZStd::make_unique<nqr::AudioData>();
+	if (DecodedSourceCache::Load(sourceHash, *audioData))
+	{
+		AZ_Info("SoundAssetBuilder", "Using the decoded source cached by an earlier job.");
+	}
+	else
+	{
+		nyquist_io.Load(audioData.get(), fileBuffer);
+		if (audioData->samples.empty())
+		{
+			AZ_Error("SoundAssetBuilder", false, "Failed to load audio data, failed to decode source.");
+			return false;
+		}
+		DecodedSourceCache::Store(sourceHash, *audioData);
+	}
+
+	soundAsset.m_importFormat = settings.m_format;
+	if (soundAsset.m_importFormat != AudioImportFormat::OriginalFile)
+	{
+		//Only OriginalFile needs the source bytes once decoded, don't keep them through the encode.
+		std::vector<uint8_t>().swap(fileBuffer);
+	}
+
+	soundAsset.m_loadMethod = settings.m_loadMethod;
+	soundAsset.m_precision = settings.m_precision;
+	if (soundAsset.m_importFormat == AudioImportFormat::Adpcm)
+	{
+		//Blocks decode to 16 bit, the preset's precision doesn't apply.
+		soundAsset.m_precision = SamplePrecision::Int16;
+	}
+
+	//Before resampling so there's less of it to do. OriginalFile keeps the source bytes, so it keeps every channel too.
+	if (audioData->channelCount > 1 && soundAsset.m_importFormat != AudioImportFormat::OriginalFile
+		&& (settings.m_downmix == DownmixMode::Mono || (settings.m_downmix == DownmixMode::Auto && HasIdenticalChannels(audioData.get()))))
+	{
+		AZ_Info("SoundAssetBuilder", "Mixing %d channels down to mono.", audioData->channelCount);
+		DownmixToMono(audioData.get());
+	}
+
+	if (soundAsset.m_importFormat == AudioImportFormat::Opus && audioData->channelCount > 2)
+	{
+		AZ_Warning("SoundAssetBuilder", false, "Opus is only used for mono and stereo, encoding %d channels as Vorbis.", audioData->channelCount);
+		soundAsset.m_importFormat = AudioImportFormat::Vorbis;
+	}
+
+	const SoundBuilderSettings* globalSettings = settingsManager->GetGlobalSettings(platform);
+	if (soundAsset.m_loadMethod == AudioLoadMethod::DecodeOnDemand)
+	{
+		//Only Vorbis and Opus can be streamed, everything else falls back to being decoded on load.
+		const bool streamingEnabled = globalSettings == nullptr || globalSettings->m_enableStreaming;
+		const bool streamable = soundAsset.m_importFormat == AudioImportFormat::Vorbis || soundAsset.m_importFormat == AudioImportFormat::Opus;
+		if (!streamingEnabled || !streamable)
+		{
+			soundAsset.m_loadMethod = AudioLoadMethod::DecodeOnLoad;
+		}
+	}
+
+	//OriginalFile keeps the source bytes, so it keeps the source rate too.
+	if (settings.m_sampleRate > 0 && soundAsset.m_importFormat != AudioImportFormat::OriginalFile
+		&& static_cast<AZ::u32>(audioData->sampleRate) != settings.m_sampleRate)
+	{
+		AZ_Info("SoundAssetBuilder", "Resampling from %d Hz to %u Hz.", audioData->sampleRate, settings.m_sampleRate);
+		ResampleAudio(audioData.get(), settings.m_sampleRate);
+	}
+
+	//Opus only runs at a few fixed rates, anything else goes up to 48kHz.
+	if (soundAsset.m_importFormat == AudioImportFormat::Opus && !OpusPacketDecoder::IsSupportedSampleRate(audioData->sampleRate))
+	{
+		ResampleAudio(audioData.get(), 48000);
+	}
+
+	soundAsset.m_channels = audioData->channelCount;
+	soundAsset.m_sampleRate = audioData->sampleRate;
+	soundAsset.m_totalSamples = audioData->samples.size();
+
+	//Measured on what will actually play, the runtime turns it into a gain on the player.
+	const LoudnessMeasurement loudness = LoudnessMeter::Measure(audioData->samples.data(), audioData->channelCount,
+		audioData->sampleRate, audioData->samples.size() / audioData->channelCount);
+	soundAsset.m_loudness = loudness.m_integratedLoudness;
+	soundAsset.m_truePeak = loudness.m_truePeak;
+	soundAsset.m_volume = settings.m_volumeAdjustment;
+	soundAsset.m_presetName = settings.m_presetName;
+	AZ_Info("SoundAssetBuilder", "Integrated loudness %.1f LUFS, true peak %.1f dBTP.", loudness.m_integratedLoudness, loudness.m_truePeak);
+
+	if (waveformPeaks != nullptr)
+	{
+		*waveformPeaks = WaveformPeaksBuilder::Build(audioData->samples.data(), audioData->channelCount, audioData->sampleRate,
+			audioData->samples.size() / audioData->channelCount);
+	}
+
+	//Logged so a corpus can be timed with and without parallel encoding.
+	const auto encodeStart = AZStd::chrono::steady_clock::now();
+	switch (soundAsset.m_importFormat)
+	{
+	case AudioImportFormat::OriginalFile:
+		rawAudioData.assign(fileBuffer.begin(), fileBuffer.end());
+		break;
+	case AudioImportFormat::Uncompressed:
+		rawAudioData = DeinterleavePcm(audioData.get(), soundAsset.m_precision);
+		break;
+	case AudioImportFormat::Vorbis:
+		rawAudioData = CompressVorbis(audioData.get(), settings, globalSettings == nullptr || globalSettings->m_parallelEncode,
+			static_cast<AZ::u32>(sourceHash.GetHash()), soundAsset.m_segments, soundAsset.m_seekTable);
+		if (rawAudioData.empty())
+		{
+			AZ_Error("SoundAssetBuilder", false, "Failed to compress file '%s' to OGG Vorbis.", fromFile.c_str());
+			return false;
+		}
+		break;
+	case AudioImportFormat::Opus:
+		rawAudioData = CompressOpus(audioData.get(), settings, soundAsset.m_segments, soundAsset.m_seekTable);
+		if (rawAudioData.empty())
+		{
+			AZ_Error("SoundAssetBuilder", false, "Failed to compress file '%s' to Opus.", fromFile.c_str());
+			return false;
+		}
+		break;
+	case AudioImportFormat::Adpcm:
+		rawAudioData = CompressAdpcm(audioData.get());
+		break;
+	default:
+		AZ_Error("SoundAssetBuilder", false, "Unknown import format.");
+		return false;
+	}
+	const auto encodeTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - encodeStart);
+	AZ_Info("SoundAssetBuilder", "Encoded %.1f seconds of audio to %zu bytes in %lld ms.",
+		static_cast<double>(soundAsset.m_totalSamples / soundAsset.m_channels) / soundAsset.m_sampleRate, rawAudioData.size(),
+		static_cast<long long>(encodeTime.count()));
+
+	soundAsset.m_payloadHash = AZ::Uuid::CreateData(rawAudioData.data(), rawAudioData.size());
+	return true;
+}
+
+bool SoundAssetBuilder::WriteSoundProduct(AZ::IO::GenericStream& stream, const SoundAsset& soundAsset, const AZStd::vector<AZ::u8>& rawAudioData,
+	AZ::SerializeContext* serializeContext)
+{
+	if (!AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &soundAsset, serializeContext))
+	{
+		AZ_Error("SoundAssetBuilder", false, "Failed to save Sune metadata.");
+		return false;
+	}
+
+	if (soundAsset.m_importFormat == AudioImportFormat::Uncompressed || soundAsset.m_importFormat == AudioImportFormat::Adpcm)
+	{
+		//Pad so the PCM starts on a page boundary and can be mapped at runtime.
+		const AZ::u64 headerEnd = stream.GetCurPos();
+		const AZStd::vector<AZ::u8> padding(AZ_SIZE_ALIGN_UP(headerEnd, SoundAsset::UncompressedAlignment) - headerEnd, 0);
+		if (stream.Write(padding.size(), padding.data()) != padding.size())
+		{
+			AZ_Error("SoundAssetBuilder", false, "Failed to write padding.");
+			return false;
+		}
+	}
+
+	if (stream.Write(rawAudioData.size(), rawAudioData.data()) != rawAudioData.size())
+	{
+		AZ_Error("SoundAssetBuilder", false, "Failed to write raw audio data.");
+		return false;
+	}
+	return true;
 }
 
 void SoundAssetBuilder::ShutDown()
 {}
 
-AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings) const
+void SoundAssetBuilder::ResampleAudio(nqr::AudioData* audioData, AZ::u32 sampleRate) const
 {
-	AZStd::vector<AZ::u8> encodedData;
+	const size_t channels = audioData->channelCount;
+	const AZ::u64 frames = audioData->samples.size() / channels;
+
+	const PolyphaseResampler resampler(audioData->sampleRate, sampleRate);
+	std::vector<float> resampled(resampler.GetOutputFrames(frames) * channels);
+	for (size_t ch = 0; ch < channels; ++ch)
+	{
+		resampler.Process(audioData->samples.data() + ch, frames, channels, resampled.data() + ch, channels);
+	}
+
+	audioData->samples = AZStd::move(resampled);
+	audioData->sampleRate = static_cast<int>(sampleRate);
+	audioData->lengthSeconds = static_cast<double>(resampler.GetOutputFrames(frames)) / sampleRate;
+}
+
+bool SoundAssetBuilder::HasIdenticalChannels(const nqr::AudioData* audioData)
+{
+	const size_t channels = audioData->channelCount;
+	const size_t frames = audioData->samples.size() / channels;
+
+	//Compares the energy of what each channel adds over the mono mix against the mix itself.
+	double mixEnergy = 0.0;
+	double differenceEnergy = 0.0;
+	for (size_t i = 0; i < frames; ++i)
+	{
+		const float* frame = audioData->samples.data() + i * channels;
+		float mix = 0.0f;
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			mix += frame[ch];
+		}
+		mix /= static_cast<float>(channels);
+
+		mixEnergy += static_cast<double>(mix) * mix;
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			const double difference = frame[ch] - mix;
+			differenceEnergy += difference * difference;
+		}
+	}
+	return differenceEnergy <= IdenticalChannelThreshold * mixEnergy * static_cast<double>(channels);
+}
+
+void SoundAssetBuilder::DownmixToMono(nqr::AudioData* audioData) const
+{
+	const size_t channels = audioData->channelCount;
+	const size_t frames = audioData->samples.size() / channels;
+
+	//Averaged like LoadInternal does, so a mono mix of a centred sound keeps its level.
+	const float scale = 1.0f / static_cast<float>(channels);
+	for (size_t i = 0; i < frames; ++i)
+	{
+		const float* frame = audioData->samples.data() + i * channels;
+		float mix = 0.0f;
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			mix += frame[ch];
+		}
+		//Never ahead of the frame being read, so it can be done in place.
+		audioData->samples[i] = mix * scale;
+	}
+
+	audioData->samples.resize(frames);
+	audioData->samples.shrink_to_fit();
+	audioData->channelCount = 1;
+}
+
+AZStd::vector<AZ::u8> SoundAssetBuilder::DeinterleavePcm(const nqr::AudioData* audioData, SamplePrecision precision) const
+{
+	const size_t channels = audioData->channelCount;
+	const size_t frames = audioData->samples.size() / channels;
+
+	//Written in the resident precision so the runtime can map it without converting.
+	AZStd::vector<AZ::u8> pcmData(frames * channels * GetSampleSize(precision));
+	if (precision == SamplePrecision::Float32)
+	{
+		AZStd::vector<float*> planar(channels);
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			planar[ch] = reinterpret_cast<float*>(pcmData.data()) + ch * frames;
+		}
+		DeinterleaveSamples(audioData->samples.data(), channels, frames, planar.data());
+		return pcmData;
+	}
+
+	//Packed a chunk at a time, a planar float copy of a long sound would be twice the size of the result.
+	constexpr size_t ChunkFrames = 4096;
+	AZStd::vector<float> chunk(ChunkFrames * channels);
+	AZStd::vector<float*> planar(channels);
+	for (size_t ch = 0; ch < channels; ++ch)
+	{
+		planar[ch] = chunk.data() + ch * ChunkFrames;
+	}
+
+	AZ::u16* packed = reinterpret_cast<AZ::u16*>(pcmData.data());
+	for (size_t i = 0; i < frames; i += ChunkFrames)
+	{
+		const size_t count = AZStd::min(ChunkFrames, frames - i);
+		DeinterleaveSamples(audioData->samples.data() + i * channels, channels, count, planar.data());
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			PackSamples(precision, planar[ch], packed + ch * frames + i, count);
+		}
+	}
+	return pcmData;
+}
+
+//One chained part of a Vorbis payload and where its pages start, so restart points can be placed once the parts are joined.
+struct VorbisPart
+{
+	struct Page
+	{
+		AZ::u64 m_offset = 0;
+		ogg_int64_t m_granule = -1;
+		bool m_endOfStream = false;
+	};
+
+	AZStd::vector<AZ::u8> m_data;
+	AZStd::vector<Page> m_pages;
+};
+
+//Encodes frameCount frames from firstFrame as a complete Ogg Vorbis stream with its own headers.
+//Granule positions are offset by firstFrame so they count from the start of the whole sound.
+static bool EncodeVorbisPart(const nqr::AudioData* audioData, float quality, AZ::u64 firstFrame, AZ::u64 frameCount, int serial,
+	VorbisPart& part)
+{
+	auto writePage = [&part](const ogg_page& og)
+	{
+		part.m_pages.push_back({part.m_data.size(), ogg_page_granulepos(&og), ogg_page_eos(&og) != 0});
+		part.m_data.insert(part.m_data.end(), og.header, og.header + og.header_len);
+		part.m_data.insert(part.m_data.end(), og.body, og.body + og.body_len);
+	};
 
 	vorbis_info vi;
 	vorbis_comment vc;
@@ -231,14 +523,13 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 
 	vorbis_info_init(&vi);
 
-	float quality = settings.m_quality;
 	int ret = vorbis_encode_init_vbr(&vi, audioData->channelCount, audioData->sampleRate, quality);
 
 	if (ret != 0)
 	{
 		AZ_Error("SoundAssetBuilder", false, "Failed to initialize vorbis encoder.");
 		vorbis_info_clear(&vi);
-		return encodedData;
+		return false;
 	}
 
 	vorbis_comment_init(&vc);
@@ -247,7 +538,7 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 	vorbis_analysis_init(&vd, &vi);
 	vorbis_block_init(&vd, &vb);
 
-	ogg_stream_init(&os, tuls_random.GetRandom());
+	ogg_stream_init(&os, serial);
 
 	ogg_packet header;
 	ogg_packet header_comm;
@@ -260,29 +551,18 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 
 	while (ogg_stream_flush(&os, &og))
 	{
-		encodedData.insert(encodedData.end(),
-						  reinterpret_cast<AZ::u8*>(og.header),
-						  reinterpret_cast<AZ::u8*>(og.header) + og.header_len);
-		encodedData.insert(encodedData.end(),
-						  reinterpret_cast<AZ::u8*>(og.body),
-						  reinterpret_cast<AZ::u8*>(og.body) + og.body_len);
+		writePage(og);
 	}
 
-	constexpr int BUFFER_SIZE = 1024;
-	int samples_per_channel = audioData->samples.size() / audioData->channelCount;
+	constexpr AZ::u64 BUFFER_SIZE = 1024;
+	const size_t channels = audioData->channelCount;
 
-	for (int i = 0; i < samples_per_channel; i += BUFFER_SIZE)
+	for (AZ::u64 i = 0; i < frameCount; i += BUFFER_SIZE)
 	{
-		int samples_to_process = AZStd::min(BUFFER_SIZE, samples_per_channel - i);
+		const int samples_to_process = static_cast<int>(AZStd::min(BUFFER_SIZE, frameCount - i));
 
 		float** buffer = vorbis_analysis_buffer(&vd, samples_to_process);
-
-		//non interleaved (converting from interleaved input)
-		for (int ch = 0; ch < audioData->channelCount; ch++) {
-			for (int j = 0; j < samples_to_process; j++) {
-				buffer[ch][j] = audioData->samples[(i + j) * audioData->channelCount + ch];
-			}
-		}
+		DeinterleaveSamples(audioData->samples.data() + (firstFrame + i) * channels, channels, samples_to_process, buffer);
 
 		vorbis_analysis_wrote(&vd, samples_to_process);
 
@@ -293,16 +573,12 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 
 			while (vorbis_bitrate_flushpacket(&vd, &op))
 			{
+				op.granulepos += firstFrame;
 				ogg_stream_packetin(&os, &op);
 
 				while (ogg_stream_pageout(&os, &og))
 				{
-					encodedData.insert(encodedData.end(),
-									  reinterpret_cast<AZ::u8*>(og.header),
-									  reinterpret_cast<AZ::u8*>(og.header) + og.header_len);
-					encodedData.insert(encodedData.end(),
-									  reinterpret_cast<AZ::u8*>(og.body),
-									  reinterpret_cast<AZ::u8*>(og.body) + og.body_len);
+					writePage(og);
 				}
 			}
 		}
@@ -315,15 +591,11 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 		vorbis_bitrate_addblock(&vb);
 
 		while (vorbis_bitrate_flushpacket(&vd, &op)) {
+			op.granulepos += firstFrame;
 			ogg_stream_packetin(&os, &op);
 
 			while (ogg_stream_flush(&os, &og)) {
-				encodedData.insert(encodedData.end(),
-								  reinterpret_cast<AZ::u8*>(og.header),
-								  reinterpret_cast<AZ::u8*>(og.header) + og.header_len);
-				encodedData.insert(encodedData.end(),
-								  reinterpret_cast<AZ::u8*>(og.body),
-								  reinterpret_cast<AZ::u8*>(og.body) + og.body_len);
+				writePage(og);
 			}
 		}
 	}
@@ -334,5 +606,220 @@ AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* au
 	vorbis_comment_clear(&vc);
 	vorbis_info_clear(&vi);
 
+	return true;
+}
+
+AZStd::vector<AZ::u8> SoundAssetBuilder::CompressVorbis(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings,
+	bool parallel, AZ::u32 serial, AZStd::vector<SoundSegment>& segments, AZStd::vector<SoundSegment>& seekTable) const
+{
+	AZStd::vector<AZ::u8> encodedData;
+	segments.clear();
+	seekTable.clear();
+
+	//Long sounds are split into parts that encode at the same time and are joined as chained streams.
+	//Where they split only depends on the length, so the output is the same however many jobs ran.
+	//The last part takes the remainder rather than leaving a short one to pay for a copy of the headers.
+	const AZ::u64 frames = audioData->samples.size() / audioData->channelCount;
+	const AZ::u64 partFrames = static_cast<AZ::u64>(audioData->sampleRate) * VorbisPartSeconds;
+	const size_t partCount = static_cast<size_t>(AZStd::max<AZ::u64>(frames / partFrames, 1));
+
+	AZStd::vector<VorbisPart> parts(partCount);
+	AZStd::atomic_int failures = 0;
+	auto encodePart = [&](size_t i)
+	{
+		const AZ::u64 firstFrame = i * partFrames;
+		const AZ::u64 frameCount = i + 1 == partCount ? frames - firstFrame : partFrames;
+		//Each part needs its own serial for the decoder to see where it starts.
+		if (!EncodeVorbisPart(audioData, settings.m_quality, firstFrame, frameCount, static_cast<int>(serial + i), parts[i]))
+		{
+			++failures;
+		}
+	};
+
+	if (parallel && partCount > 1)
+	{
+		AZ::JobCompletion completion;
+		for (size_t i = 0; i < partCount; ++i)
+		{
+			AZ::Job* job = AZ::CreateJobFunction([&encodePart, i]()
+			{
+				encodePart(i);
+			}, true);
+			job->SetDependent(&completion);
+			job->Start();
+		}
+		completion.StartAndWaitForCompletion();
+	}
+	else
+	{
+		for (size_t i = 0; i < partCount; ++i)
+		{
+			encodePart(i);
+		}
+	}
+
+	if (failures > 0)
+	{
+		return encodedData;
+	}
+
+	//Record a restart point every few seconds so the runtime can decode segments in parallel.
+	//The first comes early so only a short head has to be decoded before playback can start.
+	const AZ::u64 segmentFrames = static_cast<AZ::u64>(audioData->sampleRate) * SegmentSeconds;
+	AZ::u64 nextSegmentFrame = static_cast<AZ::u64>(audioData->sampleRate) * HeadMilliseconds / 1000;
+	size_t totalSize = 0;
+	for (const VorbisPart& part : parts)
+	{
+		totalSize += part.m_data.size();
+	}
+	encodedData.reserve(totalSize);
+
+	for (VorbisPart& part : parts)
+	{
+		const AZ::u64 partOffset = encodedData.size();
+		for (const VorbisPart::Page& page : part.m_pages)
+		{
+			if (page.m_granule >= 0 && static_cast<AZ::u64>(page.m_granule) >= nextSegmentFrame && !page.m_endOfStream)
+			{
+				segments.push_back({partOffset + page.m_offset, static_cast<AZ::u64>(page.m_granule)});
+				nextSegmentFrame = page.m_granule + segmentFrames;
+			}
+
+			//Header pages have a granule of 0, seeking to the start rewinds instead.
+			if (page.m_granule > 0)
+			{
+				seekTable.push_back({partOffset + page.m_offset, static_cast<AZ::u64>(page.m_granule)});
+			}
+		}
+		encodedData.insert(encodedData.end(), part.m_data.begin(), part.m_data.end());
+		//Let each part go as soon as it's copied.
+		AZStd::vector<AZ::u8>().swap(part.m_data);
+	}
+
+	return encodedData;
+}
+
+AZStd::vector<AZ::u8> SoundAssetBuilder::CompressAdpcm(const nqr::AudioData* audioData) const
+{
+	const size_t channels = audioData->channelCount;
+	const AZ::u64 frames = audioData->samples.size() / channels;
+	const float* samples = audioData->samples.data();
+
+	//Starting from the first sample saves the step size a few samples of catching up.
+	AZStd::vector<Adpcm::EncoderState> states(channels);
+	for (size_t ch = 0; ch < channels && frames > 0; ++ch)
+	{
+		AZ::u16 first = 0;
+		PackSamples(SamplePrecision::Int16, samples + ch, &first, 1);
+		states[ch].m_predictor = static_cast<AZ::s16>(first);
+	}
+
+	AZStd::vector<AZ::u8> payload(Adpcm::GetPayloadSize(static_cast<int>(channels), frames));
+	const AZ::u64 blockCount = Adpcm::GetBlockCount(frames);
+	for (AZ::u64 b = 0; b < blockCount; ++b)
+	{
+		const AZ::u64 start = b * Adpcm::BlockFrames;
+		const size_t blockFrames = static_cast<size_t>(AZStd::min<AZ::u64>(Adpcm::BlockFrames, frames - start));
+		for (size_t ch = 0; ch < channels; ++ch)
+		{
+			AZ::u8* block = payload.data() + (b * channels + ch) * Adpcm::BlockSize;
+			Adpcm::EncodeBlock(states[ch], samples + start * channels + ch, channels, blockFrames, block);
+		}
+	}
+	return payload;
+}
+
+AZStd::vector<AZ::u8> SoundAssetBuilder::CompressOpus(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings,
+	AZStd::vector<SoundSegment>& segments, AZStd::vector<SoundSegment>& seekTable) const
+{
+	AZStd::vector<AZ::u8> encodedData;
+	segments.clear();
+	seekTable.clear();
+
+	const int channels = audioData->channelCount;
+	const int sampleRate = audioData->sampleRate;
+
+	int error = OPUS_OK;
+	OpusEncoder* encoder = opus_encoder_create(sampleRate, channels, OPUS_APPLICATION_AUDIO, &error);
+	if (error != OPUS_OK)
+	{
+		AZ_Error("SoundAssetBuilder", false, "Failed to initialize the Opus encoder: %s.", opus_strerror(error));
+		return encodedData;
+	}
+
+	//Without an explicit bitrate, quality goes from 16 to 64 kbps per channel.
+	const float quality = AZStd::clamp(settings.m_quality, 0.0f, 1.0f);
+	const AZ::u32 bitrate = settings.m_bitrate > 0 ? settings.m_bitrate : static_cast<AZ::u32>(16000.0f + quality * 48000.0f);
+	opus_encoder_ctl(encoder, OPUS_SET_BITRATE(static_cast<opus_int32>(bitrate * channels)));
+	opus_encoder_ctl(encoder, OPUS_SET_COMPLEXITY(10));
+
+	opus_int32 lookahead = 0;
+	opus_encoder_ctl(encoder, OPUS_GET_LOOKAHEAD(&lookahead));
+
+	OpusPayloadHeader header;
+	header.m_channels = static_cast<AZ::u32>(channels);
+	header.m_sampleRate = static_cast<AZ::u32>(sampleRate);
+	header.m_preSkip = static_cast<AZ::u32>(lookahead);
+	header.m_frameSize = static_cast<AZ::u32>(sampleRate * OpusPacketDecoder::FrameMilliseconds / 1000);
+	header.m_totalFrames = audioData->samples.size() / channels;
+	const AZ::u8* headerBytes = reinterpret_cast<const AZ::u8*>(&header);
+	encodedData.insert(encodedData.end(), headerBytes, headerBytes + sizeof(header));
+
+	//Enough packets to get every frame out past the encoder delay, the last one is padded with silence.
+	const AZ::u64 totalPackets = (header.m_totalFrames + header.m_preSkip + header.m_frameSize - 1) / header.m_frameSize;
+
+	//Restart points sit a pre-roll after their page, so the decoder has settled by the time its output is kept.
+	const AZ::u64 preRollFrames = static_cast<AZ::u64>(sampleRate) * OpusPacketDecoder::PreRollMilliseconds / 1000;
+	const AZ::u64 segmentFrames = static_cast<AZ::u64>(sampleRate) * SegmentSeconds;
+	AZ::u64 nextSegmentFrame = static_cast<AZ::u64>(sampleRate) * HeadMilliseconds / 1000;
+
+	AZStd::vector<float> input(header.m_frameSize * channels);
+	AZStd::vector<AZ::u8> packet(OpusPacketDecoder::MaxPacketSize);
+	for (AZ::u64 p = 0; p < totalPackets; ++p)
+	{
+		if (p % OpusPacketDecoder::PagePackets == 0)
+		{
+			const AZ::u64 restartFrame = p * header.m_frameSize + preRollFrames - header.m_preSkip;
+			if (p > 0 && restartFrame < header.m_totalFrames)
+			{
+				if (restartFrame >= nextSegmentFrame)
+				{
+					segments.push_back({encodedData.size(), restartFrame});
+					nextSegmentFrame = restartFrame + segmentFrames;
+				}
+				seekTable.push_back({encodedData.size(), restartFrame});
+			}
+
+			OpusPageHeader page;
+			page.m_firstPacket = static_cast<AZ::u32>(p);
+			page.m_packetCount = static_cast<AZ::u32>(AZStd::min<AZ::u64>(OpusPacketDecoder::PagePackets, totalPackets - p));
+			const AZ::u8* pageBytes = reinterpret_cast<const AZ::u8*>(&page);
+			encodedData.insert(encodedData.end(), pageBytes, pageBytes + sizeof(page));
+		}
+
+		const AZ::u64 firstFrame = p * header.m_frameSize;
+		const AZ::u64 frames = firstFrame < header.m_totalFrames ? AZStd::min<AZ::u64>(header.m_frameSize, header.m_totalFrames - firstFrame) : 0;
+		AZStd::fill(input.begin(), input.end(), 0.0f);
+		if (frames > 0)
+		{
+			memcpy(input.data(), audioData->samples.data() + firstFrame * channels, frames * channels * sizeof(float));
+		}
+
+		const opus_int32 size = opus_encode_float(encoder, input.data(), static_cast<int>(header.m_frameSize),
+			packet.data(), static_cast<opus_int32>(packet.size()));
+		if (size < 0)
+		{
+			AZ_Error("SoundAssetBuilder", false, "Failed to encode an Opus packet: %s.", opus_strerror(size));
+			opus_encoder_destroy(encoder);
+			return {};
+		}
+
+		const AZ::u16 packetSize = static_cast<AZ::u16>(size);
+		const AZ::u8* sizeBytes = reinterpret_cast<const AZ::u8*>(&packetSize);
+		encodedData.insert(encodedData.end(), sizeBytes, sizeBytes + sizeof(packetSize));
+		encodedData.insert(encodedData.end(), packet.data(), packet.data() + size);
+	}
+
+	opus_encoder_destroy(encoder);
 	return encodedData;
 }
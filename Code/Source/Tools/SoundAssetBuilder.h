@@ -7,9 +7,16 @@
 #pragma once
 
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/IO/GenericStreams.h>
 
 #include "Sune/SuneTypeIds.h"
 
+namespace AZ
+{
+    class SerializeContext;
+}
+
 namespace nqr
 {
     struct AudioData;
@@ -17,7 +24,10 @@ namespace nqr
 
 namespace Sune
 {
+    class SoundAsset;
     struct SoundAssetBuilderSettings;
+    struct SoundSegment;
+    enum class SamplePrecision;
     class SoundAssetBuilder
         : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
     {
@@ -30,7 +40,47 @@ namespace Sune
         void ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
         void ShutDown() override;
 
+        //Sources every sound job depends on, shared with the bank builder.
+        static void AddSettingsDependencies(AssetBuilderSDK::CreateJobsResponse& response);
+        static void AddSettingsPathDependencies(AssetBuilderSDK::JobProduct& product);
+
+        //Decodes the source and converts it with the settings for the platform, fills in the header and payload.
+        //waveformPeaks gets the WaveformPeaks file for what will play if it's set.
+        bool BuildSound(const AZStd::string& sourcePath, const AZStd::string& platform, SoundAsset& soundAsset,
+            AZStd::vector<AZ::u8>& payload, AZStd::vector<AZ::u8>* waveformPeaks = nullptr) const;
+        //Writes the header followed by the payload, the same layout LoadAssetData reads.
+        //The header is saved with the application's serialize context unless one is given.
+        static bool WriteSoundProduct(AZ::IO::GenericStream& stream, const SoundAsset& soundAsset, const AZStd::vector<AZ::u8>& payload,
+            AZ::SerializeContext* serializeContext = nullptr);
+
+        //Length of the independently decodable Vorbis and Opus segments.
+        static constexpr int SegmentSeconds = 4;
+        //The first segment is kept short, it's decoded before the asset is ready and the rest decodes while it plays.
+        static constexpr int HeadMilliseconds = 250;
+        //Vorbis sounds at least twice this long are split into parts this long that encode at the same time.
+        static constexpr int VorbisPartSeconds = 30;
+
+        //Energy of the channels' difference from their mix, relative to the mix, below which they count as identical (-60dB).
+        static constexpr double IdenticalChannelThreshold = 1e-6;
+
         //Util
-        AZStd::vector<AZ::u8> CompressVorbis(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings) const;
+        //True if every channel is close enough to the others that a mono mix sounds the same.
+        static bool HasIdenticalChannels(const nqr::AudioData* audioData);
+        //Averages every channel into one, in place.
+        void DownmixToMono(nqr::AudioData* audioData) const;
+        //Converts the decoded source to sampleRate in place, before it's encoded.
+        void ResampleAudio(nqr::AudioData* audioData, AZ::u32 sampleRate) const;
+        //Planar float PCM for the Uncompressed format.
+        AZStd::vector<AZ::u8> DeinterleavePcm(const nqr::AudioData* audioData, SamplePrecision precision) const;
+        //Fills segments with the parallel decode restart points and seekTable with every audio page.
+        //Long sounds are encoded as chained parts, on jobs of their own if parallel is set.
+        //serial is the first part's stream serial, taken from the source so the same input always gives the same bytes.
+        AZStd::vector<AZ::u8> CompressVorbis(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings, bool parallel,
+            AZ::u32 serial, AZStd::vector<SoundSegment>& segments, AZStd::vector<SoundSegment>& seekTable) const;
+        //Block ADPCM in the layout CompactSoundSource decodes from.
+        AZStd::vector<AZ::u8> CompressAdpcm(const nqr::AudioData* audioData) const;
+        //Same restart points as CompressVorbis, in the packet layout OpusPacketDecoder reads.
+        AZStd::vector<AZ::u8> CompressOpus(const nqr::AudioData* audioData, const SoundAssetBuilderSettings& settings,
+            AZStd::vector<SoundSegment>& segments, AZStd::vector<SoundSegment>& seekTable) const;
     };
 }
@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBankBuilder.h"
+#include "SoundAssetBuilder.h"
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/IOUtils.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+
+#include "Sune/SoundBankAsset.h"
+
+using namespace Sune;
+
+void SoundBankSourceData::Reflect(AZ::ReflectContext* context)
+{
+    auto sc = azrtti_cast<AZ::SerializeContext*>(context);
+    if (!sc)
+        return;
+    sc->Class<SoundBankSourceData>()
+        ->Version(0)
+        ->Field("sounds", &SoundBankSourceData::m_sounds)
+        ;
+}
+
+//Zero fills up to the next multiple of alignment.
+static bool WritePadding(AZ::IO::GenericStream& stream, AZ::u64 alignment)
+{
+	const AZ::u64 position = stream.GetCurPos();
+	const AZStd::vector<AZ::u8> padding(AZ_SIZE_ALIGN_UP(position, alignment) - position, 0);
+	return stream.Write(padding.size(), padding.data()) == padding.size();
+}
+
+SoundBankBuilder::SoundBankBuilder(const SoundAssetBuilder& soundBuilder)
+	: m_soundBuilder(soundBuilder)
+{}
+
+bool SoundBankBuilder::LoadSourceData(const AZStd::string& bankPath, SoundBankSourceData& sourceData)
+{
+	auto loadResult = AZ::JsonSerializationUtils::ReadJsonFile(bankPath);
+	if (!loadResult.IsSuccess())
+	{
+		AZ_Error("SoundBankBuilder", false, "Failed to read sound bank '%s'. Error: %s", bankPath.c_str(), loadResult.GetError().c_str());
+		return false;
+	}
+
+	AZ::JsonDeserializerSettings deserializeSettings;
+	auto result = AZ::JsonSerialization::Load(sourceData, loadResult.GetValue(), deserializeSettings);
+	if (result.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
+	{
+		AZ_Error("SoundBankBuilder", false, "Failed to load sound bank '%s'.", bankPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool SoundBankBuilder::FindSoundSource(const AZStd::string& soundPath, AZ::Uuid& sourceUuid) const
+{
+	bool found = false;
+	AZ::Data::AssetInfo sourceInfo;
+	AZStd::string watchFolder;
+	AzToolsFramework::AssetSystemRequestBus::BroadcastResult(found,
+		&AzToolsFramework::AssetSystemRequestBus::Events::GetSourceInfoBySourcePath, soundPath.c_str(), sourceInfo, watchFolder);
+	sourceUuid = sourceInfo.m_assetId.m_guid;
+	return found;
+}
+
+AZStd::string SoundBankBuilder::GetSoundPath(const AZStd::string& bankPath, const AZStd::string& sound)
+{
+	return (AZ::IO::Path(bankPath).ParentPath() / sound).LexicallyNormal().String();
+}
+
+void SoundBankBuilder::CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request,
+	AssetBuilderSDK::CreateJobsResponse& response) const
+{
+	AZStd::string bankPath;
+	AzFramework::StringFunc::Path::ConstructFull(request.m_watchFolder.c_str(), request.m_sourceFile.c_str(), bankPath, true);
+
+	SoundBankSourceData sourceData;
+	if (!LoadSourceData(bankPath, sourceData))
+	{
+		response.m_result = AssetBuilderSDK::CreateJobsResultCode::Failed;
+		return;
+	}
+
+	//Members are converted with the same settings as their own products.
+	SoundAssetBuilder::AddSettingsDependencies(response);
+	for (const AZStd::string& sound : sourceData.m_sounds)
+	{
+		AssetBuilderSDK::SourceFileDependency soundDep;
+		soundDep.m_sourceFileDependencyPath = GetSoundPath(bankPath, sound);
+		soundDep.m_sourceDependencyType = AssetBuilderSDK::SourceFileDependency::SourceFileDependencyType::Absolute;
+		response.m_sourceFileDependencyList.push_back(soundDep);
+	}
+
+	for (const AssetBuilderSDK::PlatformInfo& platformInfo : request.m_enabledPlatforms)
+	{
+		AssetBuilderSDK::JobDescriptor jobDescriptor;
+		jobDescriptor.m_critical = true;
+		jobDescriptor.m_jobKey = "Sune SoundBank";
+		jobDescriptor.SetPlatformIdentifier(platformInfo.m_identifier.c_str());
+
+		response.m_createJobOutputs.push_back(jobDescriptor);
+	}
+
+	response.m_result = AssetBuilderSDK::CreateJobsResultCode::Success;
+}
+
+void SoundBankBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request,
+	AssetBuilderSDK::ProcessJobResponse& response) const
+{
+	response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+
+	SoundBankSourceData sourceData;
+	if (!LoadSourceData(request.m_fullPath, sourceData))
+	{
+		return;
+	}
+
+	AZ::Data::Asset<SoundBankAsset> bankAsset;
+	bankAsset.Create(AZ::Data::AssetId(request.m_sourceFileUUID, SoundBankAsset::AssetSubId));
+
+	//Members are laid out exactly like their own products, each on a page boundary.
+	AZStd::vector<AZ::u8> memberData;
+	AZ::IO::ByteContainerStream<AZStd::vector<AZ::u8>> memberStream(&memberData);
+	for (const AZStd::string& sound : sourceData.m_sounds)
+	{
+		const AZStd::string soundPath = GetSoundPath(request.m_fullPath, sound);
+
+		//Members keep the id of the sound's own product so players don't need to know about the bank.
+		AZ::Uuid sourceUuid;
+		if (!FindSoundSource(soundPath, sourceUuid))
+		{
+			AZ_Error("SoundBankBuilder", false, "Sound '%s' in bank '%s' isn't a known source.", soundPath.c_str(), request.m_fullPath.c_str());
+			return;
+		}
+
+		AZ::Data::Asset<SoundAsset> soundAsset;
+		soundAsset.Create(AZ::Data::AssetId(sourceUuid, SoundAsset::AssetSubId));
+
+		AZStd::vector<AZ::u8> payload;
+		if (!m_soundBuilder.BuildSound(soundPath, request.m_platformInfo.m_identifier, *soundAsset.Get(), payload))
+		{
+			AZ_Error("SoundBankBuilder", false, "Failed to build sound '%s' for bank '%s'.", soundPath.c_str(), request.m_fullPath.c_str());
+			return;
+		}
+
+		SoundBankEntry entry;
+		entry.m_assetId = soundAsset.GetId();
+		if (!WritePadding(memberStream, SoundBankAsset::MemberAlignment))
+		{
+			return;
+		}
+		entry.m_offset = memberStream.GetCurPos();
+		if (!SoundAssetBuilder::WriteSoundProduct(memberStream, *soundAsset.Get(), payload))
+		{
+			return;
+		}
+		entry.m_size = memberStream.GetCurPos() - entry.m_offset;
+		bankAsset->m_entries.push_back(entry);
+	}
+
+	AZStd::string filename;
+	AzFramework::StringFunc::Path::GetFileName(request.m_sourceFile.c_str(), filename);
+	AzFramework::StringFunc::Path::ReplaceExtension(filename, SoundBankAsset::FileExtension);
+
+	AZStd::string outputPath;
+	AzFramework::StringFunc::Path::ConstructFull(request.m_tempDirPath.c_str(), filename.c_str(), outputPath, true);
+
+	AZ::IO::FileIOStream dataStream(outputPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+	if (!AZ::IO::RetryOpenStream(dataStream))
+	{
+		AZ_Error("SoundBankBuilder", false, "Failed to open file '%s' for writing.", outputPath.c_str());
+		return;
+	}
+
+	//Index first, then the members from the next page boundary.
+	if (!AZ::Utils::SaveObjectToStream(dataStream, AZ::DataStream::ST_BINARY, bankAsset.Get())
+		|| !WritePadding(dataStream, SoundBankAsset::MemberAlignment)
+		|| dataStream.Write(memberData.size(), memberData.data()) != memberData.size())
+	{
+		AZ_Error("SoundBankBuilder", false, "Failed to write sound bank '%s'.", outputPath.c_str());
+		return;
+	}
+	dataStream.Close();
+
+	AssetBuilderSDK::JobProduct bankJobProduct;
+	if (!AssetBuilderSDK::OutputObject(
+			bankAsset.Get(), outputPath, azrtti_typeid<SoundBankAsset>(), SoundBankAsset::AssetSubId, bankJobProduct))
+	{
+		AZ_Error("SoundBankBuilder", false, "Failed to output product dependencies.");
+		return;
+	}
+
+	SoundAssetBuilder::AddSettingsPathDependencies(bankJobProduct);
+	response.m_outputProducts.push_back(AZStd::move(bankJobProduct));
+
+	response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+}
+
+void SoundBankBuilder::ShutDown()
+{}
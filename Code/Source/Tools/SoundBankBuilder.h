@@ -0,0 +1,52 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AssetBuilderSDK/AssetBuilderBusses.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include "Sune/SuneTypeIds.h"
+
+namespace Sune
+{
+    class SoundAssetBuilder;
+
+    //A .soundbank source, lists the sounds to pack relative to the bank file.
+    struct SoundBankSourceData
+    {
+        AZ_TYPE_INFO(SoundBankSourceData, "{4E9B2D71-A63C-4F18-8D5E-0B7C3A91F2E6}");
+        AZ_CLASS_ALLOCATOR(SoundBankSourceData, AZ::SystemAllocator);
+
+        AZStd::vector<AZStd::string> m_sounds;
+
+        static void Reflect(AZ::ReflectContext* context);
+    };
+
+    //Packs every sound of a .soundbank into one product, each converted the same way SoundAssetBuilder would.
+    class SoundBankBuilder
+        : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
+    {
+    public:
+        AZ_RTTI(SoundBankBuilder, SuneSoundBankBuilderTypeId);
+
+        explicit SoundBankBuilder(const SoundAssetBuilder& soundBuilder);
+
+        void CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response) const;
+        void ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
+        void ShutDown() override;
+
+    protected:
+        //Finds the source uuid of a member through the asset processor, tests override it to build banks without one.
+        virtual bool FindSoundSource(const AZStd::string& soundPath, AZ::Uuid& sourceUuid) const;
+
+    private:
+        static bool LoadSourceData(const AZStd::string& bankPath, SoundBankSourceData& sourceData);
+        static AZStd::string GetSoundPath(const AZStd::string& bankPath, const AZStd::string& sound);
+
+        const SoundAssetBuilder& m_soundBuilder;
+    };
+}
@@ -10,6 +10,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include "SoundAssetBuilder.h"
+#include "SoundBankBuilder.h"
 #include "API/ViewPaneOptions.h"
 #include "AssetBuilderSDK/AssetBuilderSDK.h"
 #include "AzFramework/Asset/GenericAssetHandler.h"
@@ -31,6 +32,7 @@ namespace Sune
         PatternMapping::Reflect(context);
         SoundPresetSettings::Reflect(context);
         MultiplatformSoundPreset::Reflect(context);
+        SoundBankSourceData::Reflect(context);
 
 
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -42,6 +44,7 @@ namespace Sune
     }
 
     SuneEditorSystemComponent::SuneEditorSystemComponent()
+        : m_soundBankBuilder(m_soundAssetBuilder)
     {
         // GraphContext::SetInstance(AZStd::make_unique<GraphContext>());
     }
@@ -82,7 +85,7 @@ namespace Sune
 
         AssetBuilderSDK::AssetBuilderDesc materialAssetBuilderDescriptor;
         materialAssetBuilderDescriptor.m_name = "Sune Sound Asset Builder";
-        materialAssetBuilderDescriptor.m_version = 1;
+        materialAssetBuilderDescriptor.m_version = 13;
 
         SoundBuilderSettingsManager* settingsManager = SoundBuilderSettingsManager::Get();
         if (settingsManager)
@@ -112,6 +115,27 @@ namespace Sune
         m_soundAssetBuilder.BusConnect(materialAssetBuilderDescriptor.m_busId);
         AssetBuilderSDK::AssetBuilderBus::Broadcast(
             &AssetBuilderSDK::AssetBuilderBus::Handler::RegisterBuilderInformation, materialAssetBuilderDescriptor);
+
+        AssetBuilderSDK::AssetBuilderDesc bankBuilderDescriptor;
+        bankBuilderDescriptor.m_name = "Sune Sound Bank Builder";
+        bankBuilderDescriptor.m_version = 12;
+        bankBuilderDescriptor.m_analysisFingerprint = materialAssetBuilderDescriptor.m_analysisFingerprint;
+        bankBuilderDescriptor.m_patterns.push_back(
+            AssetBuilderSDK::AssetBuilderPattern("*.soundbank", AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard));
+        bankBuilderDescriptor.m_busId = azrtti_typeid<SoundBankBuilder>();
+        bankBuilderDescriptor.m_createJobFunction =
+            [this](const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response)
+            {
+                m_soundBankBuilder.CreateJobs(request, response);
+            };
+        bankBuilderDescriptor.m_processJobFunction =
+            [this](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+            {
+                m_soundBankBuilder.ProcessJob(request, response);
+            };
+        m_soundBankBuilder.BusConnect(bankBuilderDescriptor.m_busId);
+        AssetBuilderSDK::AssetBuilderBus::Broadcast(
+            &AssetBuilderSDK::AssetBuilderBus::Handler::RegisterBuilderInformation, bankBuilderDescriptor);
     }
 
     void SuneEditorSystemComponent::Deactivate()
@@ -12,6 +12,7 @@
 
 #include <Clients/SuneSystemComponent.h>
 #include <Tools/SoundAssetBuilder.h>
+#include <Tools/SoundBankBuilder.h>
 
 #include "API/ToolsApplicationAPI.h"
 
@@ -44,5 +45,6 @@ namespace Sune
         void NotifyRegisterViews() override;
 
         SoundAssetBuilder m_soundAssetBuilder;
+        SoundBankBuilder m_soundBankBuilder;
     };
 } // namespace Sune
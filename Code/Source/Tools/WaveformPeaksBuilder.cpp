@@ -0,0 +1,167 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "WaveformPeaksBuilder.h"
+
+#include <Sune/WaveformPeaks.h>
+
+#include <AzCore/std/algorithm.h>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+using namespace Sune;
+
+namespace
+{
+    //Kept in full precision until written so coarse levels aren't merged from rounded values.
+    struct BinMeasurement
+    {
+        float m_min = FLT_MAX;
+        float m_max = -FLT_MAX;
+        double m_sumSquares = 0.0;
+        AZ::u64 m_frames = 0;
+    };
+
+    //Measures frames of interleaved samples into one measurement per channel.
+    void MeasureBin(const float* samples, size_t channels, size_t frames, BinMeasurement* out)
+    {
+        const size_t count = frames * channels;
+        size_t i = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //With one, two or four channels every lane always holds the same channel, lane % channels.
+        if (4 % channels == 0)
+        {
+            __m128 minimum = _mm_set1_ps(FLT_MAX);
+            __m128 maximum = _mm_set1_ps(-FLT_MAX);
+            __m128 sumSquares = _mm_setzero_ps();
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128 value = _mm_loadu_ps(samples + i);
+                minimum = _mm_min_ps(minimum, value);
+                maximum = _mm_max_ps(maximum, value);
+                sumSquares = _mm_add_ps(sumSquares, _mm_mul_ps(value, value));
+            }
+
+            alignas(16) float minimums[4];
+            alignas(16) float maximums[4];
+            alignas(16) float squares[4];
+            _mm_store_ps(minimums, minimum);
+            _mm_store_ps(maximums, maximum);
+            _mm_store_ps(squares, sumSquares);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                BinMeasurement& measurement = out[lane % channels];
+                measurement.m_min = AZStd::min(measurement.m_min, minimums[lane]);
+                measurement.m_max = AZStd::max(measurement.m_max, maximums[lane]);
+                measurement.m_sumSquares += squares[lane];
+            }
+        }
+#endif
+        //Whatever the vector loop left, i is always at the start of a frame.
+        for (; i < count; ++i)
+        {
+            BinMeasurement& measurement = out[i % channels];
+            measurement.m_min = AZStd::min(measurement.m_min, samples[i]);
+            measurement.m_max = AZStd::max(measurement.m_max, samples[i]);
+            measurement.m_sumSquares += static_cast<double>(samples[i]) * samples[i];
+        }
+
+        for (size_t ch = 0; ch < channels; ++ch)
+        {
+            out[ch].m_frames += frames;
+        }
+    }
+
+    AZ::s16 QuantizePeak(float value)
+    {
+        return static_cast<AZ::s16>(std::lrintf(AZStd::clamp(value, -1.0f, 1.0f) * WaveformPeaks::BinScale));
+    }
+
+    WaveformBin Quantize(const BinMeasurement& measurement)
+    {
+        WaveformBin bin;
+        if (measurement.m_frames > 0)
+        {
+            const double rms = std::sqrt(measurement.m_sumSquares / static_cast<double>(measurement.m_frames));
+            bin.m_min = QuantizePeak(measurement.m_min);
+            bin.m_max = QuantizePeak(measurement.m_max);
+            bin.m_rms = static_cast<AZ::u16>(std::lrint(AZStd::min(rms, 1.0) * WaveformPeaks::BinScale));
+        }
+        return bin;
+    }
+}
+
+AZStd::vector<AZ::u8> WaveformPeaksBuilder::Build(const float* samples, int channels, int sampleRate, AZ::u64 frames)
+{
+    const size_t channelCount = static_cast<size_t>(channels);
+
+    WaveformHeader header;
+    header.m_channels = static_cast<AZ::u32>(channels);
+    header.m_sampleRate = static_cast<AZ::u32>(sampleRate);
+    header.m_frames = frames;
+
+    AZStd::vector<WaveformLevel> levels;
+    for (AZ::u32 framesPerBin = WaveformPeaks::FinestFramesPerBin; framesPerBin <= WaveformPeaks::CoarsestFramesPerBin;
+        framesPerBin *= WaveformPeaks::LevelScale)
+    {
+        WaveformLevel& level = levels.emplace_back();
+        level.m_framesPerBin = framesPerBin;
+        level.m_binCount = static_cast<AZ::u32>(AZStd::max<AZ::u64>((frames + framesPerBin - 1) / framesPerBin, 1));
+    }
+    header.m_levelCount = static_cast<AZ::u32>(levels.size());
+
+    AZ::u64 offset = sizeof(WaveformHeader) + levels.size() * sizeof(WaveformLevel);
+    for (WaveformLevel& level : levels)
+    {
+        level.m_offset = offset;
+        offset += static_cast<AZ::u64>(level.m_binCount) * channelCount * sizeof(WaveformBin);
+    }
+
+    AZStd::vector<AZ::u8> file(offset);
+    memcpy(file.data(), &header, sizeof(header));
+    memcpy(file.data() + sizeof(header), levels.data(), levels.size() * sizeof(WaveformLevel));
+
+    //Finest level from the samples.
+    AZStd::vector<BinMeasurement> measurements(static_cast<size_t>(levels[0].m_binCount) * channelCount);
+    for (AZ::u64 b = 0; b * WaveformPeaks::FinestFramesPerBin < frames; ++b)
+    {
+        const AZ::u64 start = b * WaveformPeaks::FinestFramesPerBin;
+        const size_t binFrames = static_cast<size_t>(AZStd::min<AZ::u64>(WaveformPeaks::FinestFramesPerBin, frames - start));
+        MeasureBin(samples + start * channelCount, channelCount, binFrames, measurements.data() + b * channelCount);
+    }
+
+    for (size_t l = 0; l < levels.size(); ++l)
+    {
+        if (l > 0)
+        {
+            //Merged from the level before, LevelScale bins at a time.
+            AZStd::vector<BinMeasurement> coarser(static_cast<size_t>(levels[l].m_binCount) * channelCount);
+            for (size_t i = 0; i < measurements.size(); ++i)
+            {
+                const size_t bin = i / channelCount;
+                BinMeasurement& merged = coarser[(bin / WaveformPeaks::LevelScale) * channelCount + i % channelCount];
+                merged.m_min = AZStd::min(merged.m_min, measurements[i].m_min);
+                merged.m_max = AZStd::max(merged.m_max, measurements[i].m_max);
+                merged.m_sumSquares += measurements[i].m_sumSquares;
+                merged.m_frames += measurements[i].m_frames;
+            }
+            measurements = AZStd::move(coarser);
+        }
+
+        WaveformBin* bins = reinterpret_cast<WaveformBin*>(file.data() + levels[l].m_offset);
+        for (size_t i = 0; i < measurements.size(); ++i)
+        {
+            bins[i] = Quantize(measurements[i]);
+        }
+    }
+
+    return file;
+}
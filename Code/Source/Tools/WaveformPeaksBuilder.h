@@ -0,0 +1,22 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Sune
+{
+    //Builds the WaveformPeaks product from the samples the sound asset was encoded from.
+    //The finest level is measured straight from the samples, every coarser one is merged from the level before.
+    class WaveformPeaksBuilder
+    {
+    public:
+        //Interleaved float samples, returns the whole file.
+        static AZStd::vector<AZ::u8> Build(const float* samples, int channels, int sampleRate, AZ::u64 frames);
+    };
+}
@@ -13,8 +13,6 @@
 
 using namespace Sune;
 
-nqr::NyquistIO nyquist_io;
-
 std::shared_ptr<lab::AudioBus> LoadInternal(nqr::AudioData * audioData, bool mixToMono)
 {
     int numSamples = static_cast<int>(audioData->samples.size());
@@ -62,7 +60,9 @@ std::shared_ptr<lab::AudioBus> Sune::MakeBusFromAudioData(void* fileData, size_t
 {
     auto audioData = new nqr::AudioData();
     std::vector<uint8_t> rawData((uint8_t*)fileData, (uint8_t*)fileData + size);
-    nyquist_io.Load(audioData, rawData);
+    //Local so several threads can load at once, NyquistIO isn't thread safe.
+    nqr::NyquistIO nyquistIO;
+    nyquistIO.Load(audioData, rawData);
 
     auto bus = LoadInternal(audioData, false);
     if (!bus)
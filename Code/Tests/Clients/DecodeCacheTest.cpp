@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SoundFileTestFixture.h"
+
+#include "Clients/DecodeCache.h"
+
+#include <AzTest/AzTest.h>
+#include <Sune/SoundAsset.h>
+
+#include <cstring>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    constexpr size_t CachedSamples = 4096;
+    //Every test entry is the same size, the header page and then the samples.
+    constexpr AZ::u64 CachedEntryBytes = DecodeCache::DataOffset + CachedSamples * sizeof(float);
+
+    //A decoded asset the cache can store, its samples and names differ by index.
+    class CachedSound
+    {
+    public:
+        explicit CachedSound(AZ::u32 index)
+            : m_asset(AZ::Data::AssetId(AZ::Uuid::CreateName("DecodeCacheTest"), index), AZ::Data::AssetData::AssetStatus::Ready)
+            , m_samples(CachedSamples)
+        {
+            for (size_t i = 0; i < m_samples.size(); ++i)
+            {
+                m_samples[i] = static_cast<float>(index) + static_cast<float>(i) / CachedSamples;
+            }
+            m_asset.m_precision = SamplePrecision::Float32;
+            m_asset.m_channels = 2;
+            m_asset.m_sampleRate = 48000;
+            m_asset.m_totalSamples = CachedSamples;
+            m_asset.m_payloadHash = AZ::Uuid::CreateData(&index, sizeof(index));
+            m_asset.m_sampleData = m_samples.data();
+        }
+
+        //Loads from the cache into a fresh copy of the asset, true on a hit with the samples that were stored.
+        bool LoadFrom(DecodeCache& cache) const
+        {
+            SoundAsset loaded(m_asset.GetId(), AZ::Data::AssetData::AssetStatus::Ready);
+            loaded.m_precision = m_asset.m_precision;
+            loaded.m_channels = m_asset.m_channels;
+            loaded.m_sampleRate = m_asset.m_sampleRate;
+            loaded.m_totalSamples = m_asset.m_totalSamples;
+            loaded.m_payloadHash = m_asset.m_payloadHash;
+
+            const void* data = cache.Load(loaded);
+            return data != nullptr && memcmp(data, m_samples.data(), m_samples.size() * sizeof(float)) == 0;
+        }
+
+        SoundAsset m_asset;
+        AZStd::vector<float> m_samples;
+    };
+
+    class DecodeCacheTest
+        : public SoundFileTestFixture
+    {
+    protected:
+        AZStd::string GetCacheDirectory() const
+        {
+            return GetTempPath("DecodeCache");
+        }
+    };
+
+    TEST_F(DecodeCacheTest, Store_ThenLoadHits)
+    {
+        DecodeCache cache(GetCacheDirectory().c_str(), 4 * CachedEntryBytes);
+        const CachedSound sound(1);
+
+        EXPECT_FALSE(sound.LoadFrom(cache));
+        cache.Store(sound.m_asset);
+        EXPECT_TRUE(sound.LoadFrom(cache));
+
+        const DecodeCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_hits, 1u);
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_stores, 1u);
+        EXPECT_EQ(stats.m_evictions, 0u);
+        EXPECT_EQ(stats.m_sizeBytes, CachedEntryBytes);
+    }
+
+    //Room for three, a fourth pushes out whichever was used longest ago, not whichever was stored first.
+    TEST_F(DecodeCacheTest, Store_PastTheCap_EvictsLeastRecentlyUsed)
+    {
+        DecodeCache cache(GetCacheDirectory().c_str(), 3 * CachedEntryBytes);
+        const CachedSound first(1);
+        const CachedSound second(2);
+        const CachedSound third(3);
+        const CachedSound fourth(4);
+        cache.Store(first.m_asset);
+        cache.Store(second.m_asset);
+        cache.Store(third.m_asset);
+        EXPECT_TRUE(first.LoadFrom(cache));
+
+        cache.Store(fourth.m_asset);
+        EXPECT_EQ(cache.GetStats().m_evictions, 1u);
+        EXPECT_LE(cache.GetStats().m_sizeBytes, 3 * CachedEntryBytes);
+        EXPECT_FALSE(second.LoadFrom(cache));
+        EXPECT_TRUE(first.LoadFrom(cache));
+        EXPECT_TRUE(third.LoadFrom(cache));
+        EXPECT_TRUE(fourth.LoadFrom(cache));
+    }
+
+    //The order entries were used in is kept in index.txt, a new cache over the same directory picks it up.
+    TEST_F(DecodeCacheTest, Index_RestoresUseOrderAcrossInstances)
+    {
+        const CachedSound first(1);
+        const CachedSound second(2);
+        const CachedSound third(3);
+        {
+            DecodeCache cache(GetCacheDirectory().c_str(), 3 * CachedEntryBytes);
+            cache.Store(first.m_asset);
+            cache.Store(second.m_asset);
+            cache.Store(third.m_asset);
+            //Stored first but used last.
+            EXPECT_TRUE(first.LoadFrom(cache));
+        }
+        EXPECT_TRUE(Exists(GetCacheDirectory() + "/index.txt"));
+
+        //Only room for two now, the one used longest ago goes as the cache opens.
+        DecodeCache cache(GetCacheDirectory().c_str(), 2 * CachedEntryBytes);
+        EXPECT_EQ(cache.GetStats().m_evictions, 1u);
+        EXPECT_EQ(cache.GetStats().m_sizeBytes, 2 * CachedEntryBytes);
+        EXPECT_FALSE(second.LoadFrom(cache));
+        EXPECT_TRUE(third.LoadFrom(cache));
+        EXPECT_TRUE(first.LoadFrom(cache));
+    }
+
+    //An entry whose header doesn't match the asset any more counts as a miss and is dropped.
+    TEST_F(DecodeCacheTest, Load_MismatchedHeader_MissesAndDropsEntry)
+    {
+        DecodeCache cache(GetCacheDirectory().c_str(), 4 * CachedEntryBytes);
+        CachedSound sound(1);
+        cache.Store(sound.m_asset);
+        ASSERT_EQ(cache.GetStats().m_sizeBytes, CachedEntryBytes);
+
+        //Same name, the rate isn't part of it, but the header no longer agrees.
+        sound.m_asset.m_sampleRate = 44100;
+        EXPECT_FALSE(sound.LoadFrom(cache));
+
+        const DecodeCacheStats stats = cache.GetStats();
+        EXPECT_EQ(stats.m_hits, 0u);
+        EXPECT_EQ(stats.m_misses, 1u);
+        EXPECT_EQ(stats.m_sizeBytes, 0u);
+
+        //Gone from disk too, storing it again writes a fresh entry.
+        cache.Store(sound.m_asset);
+        EXPECT_EQ(cache.GetStats().m_stores, 2u);
+        EXPECT_TRUE(sound.LoadFrom(cache));
+    }
+
+    //A store that never finished leaves its temporary file, the next cache over the directory removes it.
+    TEST_F(DecodeCacheTest, Open_RemovesStaleTempFiles)
+    {
+        const AZStd::string tempFile = GetCacheDirectory() + "/entry.pcm.7.tmp";
+        {
+            DecodeCache cache(GetCacheDirectory().c_str(), 4 * CachedEntryBytes);
+            const AZ::u32 bytes = 0;
+            ASSERT_TRUE(WriteTestFile(tempFile, &bytes, sizeof(bytes)));
+        }
+        ASSERT_TRUE(Exists(tempFile));
+
+        DecodeCache cache(GetCacheDirectory().c_str(), 4 * CachedEntryBytes);
+        EXPECT_FALSE(Exists(tempFile));
+        EXPECT_EQ(cache.GetStats().m_sizeBytes, 0u);
+    }
+}
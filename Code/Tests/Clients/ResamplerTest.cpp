@@ -0,0 +1,244 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/Resampler.h"
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+
+#include <cmath>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    constexpr double Pi = 3.14159265358979323846;
+    constexpr double ToneAmplitude = 0.5;
+
+    struct RatePair
+    {
+        AZ::u32 m_from;
+        AZ::u32 m_to;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, const RatePair& rates)
+    {
+        return stream << rates.m_from << "->" << rates.m_to;
+    }
+
+    //One second of a sine at frequency Hz.
+    AZStd::vector<float> CreateTone(AZ::u32 sampleRate, double frequency)
+    {
+        AZStd::vector<float> tone(sampleRate);
+        for (size_t i = 0; i < tone.size(); ++i)
+        {
+            tone[i] = static_cast<float>(ToneAmplitude * std::sin(2.0 * Pi * frequency * i / sampleRate));
+        }
+        return tone;
+    }
+
+    AZStd::vector<float> Resample(const PolyphaseResampler& resampler, const AZStd::vector<float>& in)
+    {
+        AZStd::vector<float> out(resampler.GetOutputFrames(in.size()));
+        resampler.Process(in.data(), in.size(), 1, out.data(), 1);
+        return out;
+    }
+
+    double ToDecibels(double ratio)
+    {
+        return 20.0 * std::log10(AZStd::max(ratio, 1e-12));
+    }
+
+    //Least squares fit of a sine at frequency over the middle half, away from the zero padded edges.
+    //Gives the gain of the fitted sine and the level of everything else, both relative to the input tone in dB.
+    void MeasureTone(const AZStd::vector<float>& out, AZ::u32 sampleRate, double frequency, double& gainDb, double& residualDb)
+    {
+        const size_t begin = out.size() / 4;
+        const size_t end = out.size() * 3 / 4;
+        const double w = 2.0 * Pi * frequency / sampleRate;
+        double ss = 0.0, cc = 0.0, sc = 0.0, xs = 0.0, xc = 0.0;
+        for (size_t n = begin; n < end; ++n)
+        {
+            const double s = std::sin(w * n);
+            const double c = std::cos(w * n);
+            ss += s * s;
+            cc += c * c;
+            sc += s * c;
+            xs += out[n] * s;
+            xc += out[n] * c;
+        }
+        const double determinant = ss * cc - sc * sc;
+        const double a = (xs * cc - xc * sc) / determinant;
+        const double b = (xc * ss - xs * sc) / determinant;
+
+        double residual = 0.0;
+        for (size_t n = begin; n < end; ++n)
+        {
+            const double error = out[n] - a * std::sin(w * n) - b * std::cos(w * n);
+            residual += error * error;
+        }
+        gainDb = ToDecibels(std::sqrt(a * a + b * b) / ToneAmplitude);
+        residualDb = ToDecibels(std::sqrt(residual / (end - begin)) / (ToneAmplitude / std::sqrt(2.0)));
+    }
+
+    double MeasureLevel(const AZStd::vector<float>& out)
+    {
+        const size_t begin = out.size() / 4;
+        const size_t end = out.size() * 3 / 4;
+        double sum = 0.0;
+        for (size_t n = begin; n < end; ++n)
+        {
+            sum += static_cast<double>(out[n]) * out[n];
+        }
+        return ToDecibels(std::sqrt(sum / (end - begin)) / (ToneAmplitude / std::sqrt(2.0)));
+    }
+
+    class ResamplerTest
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<RatePair>
+    {
+    };
+
+    //Up to 80% of the lower Nyquist a tone keeps its level and comes out with nothing else above -80dB.
+    TEST_P(ResamplerTest, Process_PassbandIsFlatAndClean)
+    {
+        const RatePair rates = GetParam();
+        const PolyphaseResampler resampler(rates.m_from, rates.m_to);
+        const double lowerRate = AZStd::min(rates.m_from, rates.m_to);
+
+        for (const double fraction : {0.1, 0.3, 0.4})
+        {
+            const double frequency = fraction * lowerRate;
+            const AZStd::vector<float> out = Resample(resampler, CreateTone(rates.m_from, frequency));
+
+            double gainDb = 0.0;
+            double residualDb = 0.0;
+            MeasureTone(out, rates.m_to, frequency, gainDb, residualDb);
+            EXPECT_NEAR(gainDb, 0.0, 0.05) << frequency << "Hz";
+            EXPECT_LT(residualDb, -80.0) << frequency << "Hz";
+        }
+    }
+
+    //Anything from 55% of the output rate up would alias, it has to be at least 80dB down.
+    TEST_P(ResamplerTest, Process_StopbandIsAttenuated)
+    {
+        const RatePair rates = GetParam();
+        if (rates.m_to >= rates.m_from)
+        {
+            GTEST_SKIP() << "Upsampling has nothing to alias, images are covered by the passband residual.";
+        }
+
+        const PolyphaseResampler resampler(rates.m_from, rates.m_to);
+        for (const double fraction : {0.55, 0.7, 0.9})
+        {
+            const double frequency = fraction * rates.m_to;
+            if (frequency >= rates.m_from * 0.5)
+            {
+                continue;
+            }
+            const AZStd::vector<float> out = Resample(resampler, CreateTone(rates.m_from, frequency));
+            EXPECT_LT(MeasureLevel(out), -80.0) << frequency << "Hz";
+        }
+    }
+
+    //Blocks of any size give exactly what resampling the whole signal at once does.
+    TEST_P(ResamplerTest, Stream_MatchesProcess)
+    {
+        const RatePair rates = GetParam();
+        const PolyphaseResampler resampler(rates.m_from, rates.m_to);
+        const AZStd::vector<float> in = CreateTone(rates.m_from, 1000.0);
+        const AZStd::vector<float> expected = Resample(resampler, in);
+
+        constexpr size_t MaxBlock = 256;
+        ResamplerStream stream(resampler, MaxBlock);
+        AZStd::vector<float> out(expected.size());
+        AZStd::vector<float> zeros(stream.GetMaxInputFrames(), 0.0f);
+        size_t pushed = 0;
+        size_t pulled = 0;
+        AZ::u32 blockSeed = 12345;
+        while (pulled < out.size())
+        {
+            blockSeed = blockSeed * 1664525u + 1013904223u;
+            const size_t block = AZStd::min<size_t>(1 + (blockSeed >> 8) % MaxBlock, out.size() - pulled);
+
+            //Past the end of the input the stream is fed the same zeros Process pads with.
+            const size_t needed = stream.GetInputFramesNeeded(block);
+            const size_t available = AZStd::min(needed, in.size() - AZStd::min(pushed, in.size()));
+            stream.Push(in.data() + pushed, available);
+            stream.Push(zeros.data(), needed - available);
+            pushed += needed;
+
+            ASSERT_EQ(stream.Pull(out.data() + pulled, block), block);
+            pulled += block;
+        }
+
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            ASSERT_EQ(out[i], expected[i]) << "frame " << i;
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(Rates, ResamplerTest, ::testing::Values(
+        RatePair{44100, 48000},
+        RatePair{22050, 48000},
+        RatePair{48000, 44100},
+        RatePair{48000, 22050},
+        RatePair{96000, 48000},
+        RatePair{48000, 8000},
+        RatePair{192000, 8000}));
+
+#if defined(HAVE_BENCHMARK)
+    //A second of mono through Process, what the builder and the resample on load do per channel.
+    void ResamplerProcessBenchmark(benchmark::State& state, AZ::u32 from, AZ::u32 to)
+    {
+        const PolyphaseResampler resampler(from, to);
+        const AZStd::vector<float> in = CreateTone(from, 1000.0);
+        AZStd::vector<float> out(resampler.GetOutputFrames(in.size()));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            resampler.Process(in.data(), in.size(), 1, out.data(), 1);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(out.size()));
+    }
+
+    //One render quantum at a time, what a ResamplingSoundSource does per channel on the audio thread.
+    void ResamplerStreamBenchmark(benchmark::State& state, AZ::u32 from, AZ::u32 to)
+    {
+        constexpr size_t QuantumFrames = 128;
+        const PolyphaseResampler resampler(from, to);
+        ResamplerStream stream(resampler, QuantumFrames);
+        const AZStd::vector<float> in = CreateTone(from, 1000.0);
+        AZStd::vector<float> out(QuantumFrames);
+        size_t position = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const size_t needed = stream.GetInputFramesNeeded(QuantumFrames);
+            if (position + needed > in.size())
+            {
+                position = 0;
+            }
+            stream.Push(in.data() + position, needed);
+            position += needed;
+            stream.Pull(out.data(), QuantumFrames);
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * QuantumFrames);
+    }
+
+    BENCHMARK_CAPTURE(ResamplerProcessBenchmark, 44100To48000, 44100, 48000);
+    BENCHMARK_CAPTURE(ResamplerProcessBenchmark, 48000To44100, 48000, 44100);
+    BENCHMARK_CAPTURE(ResamplerProcessBenchmark, 48000To22050, 48000, 22050);
+    BENCHMARK_CAPTURE(ResamplerStreamBenchmark, 44100To48000, 44100, 48000);
+    BENCHMARK_CAPTURE(ResamplerStreamBenchmark, 48000To44100, 48000, 44100);
+#endif
+}
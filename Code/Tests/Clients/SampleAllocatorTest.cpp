@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SampleAllocator.h"
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //The allocator lives as long as the module, so every test works from the stats it finds and gives back what it takes.
+    class SampleAllocatorTest : public LeakDetectionFixture
+    {
+    public:
+        //What taking bytes adds to the slab bytes in use, which is the size of the block it got.
+        static size_t GetBlockSize(size_t bytes)
+        {
+            SampleAllocator& allocator = SampleAllocator::Get();
+            const AZ::u64 before = allocator.GetStats().m_slabUsedBytes;
+            void* data = allocator.Allocate(bytes, DefaultSampleGroup);
+            EXPECT_NE(data, nullptr);
+            const AZ::u64 after = allocator.GetStats().m_slabUsedBytes;
+            allocator.Free(data, bytes, DefaultSampleGroup);
+            EXPECT_EQ(allocator.GetStats().m_slabUsedBytes, before);
+            return static_cast<size_t>(after - before);
+        }
+
+        static SampleGroupStats GetGroupStats(SampleGroupId group)
+        {
+            const AZStd::vector<SampleGroupStats> groups = SampleAllocator::Get().GetGroupStats();
+            EXPECT_LT(group, groups.size());
+            return groups[group];
+        }
+    };
+
+    TEST_F(SampleAllocatorTest, Allocate_RoundsUpToAClassWastingUnderAThird)
+    {
+        EXPECT_EQ(GetBlockSize(1), SampleAllocator::MinClassSize);
+        EXPECT_EQ(GetBlockSize(SampleAllocator::MinClassSize), SampleAllocator::MinClassSize);
+
+        size_t previousBlock = SampleAllocator::MinClassSize;
+        for (size_t bytes = SampleAllocator::MinClassSize + 1; bytes <= SampleAllocator::MaxClassSize; bytes += 97)
+        {
+            const size_t block = GetBlockSize(bytes);
+            ASSERT_GE(block, bytes);
+            ASSERT_LT((block - bytes) * 3, block) << bytes << " bytes in a block of " << block;
+            ASSERT_GE(block, previousBlock);
+            previousBlock = block;
+        }
+
+        //Each class's own size fits exactly.
+        for (size_t size = SampleAllocator::MinClassSize; size <= SampleAllocator::MaxClassSize; size *= 2)
+        {
+            EXPECT_EQ(GetBlockSize(size), size);
+            if (size < SampleAllocator::MaxClassSize)
+            {
+                EXPECT_EQ(GetBlockSize(size + size / 2), size + size / 2);
+            }
+        }
+    }
+
+    TEST_F(SampleAllocatorTest, Allocate_PastTheLargestClass_GetsPagesOfItsOwn)
+    {
+        SampleAllocator& allocator = SampleAllocator::Get();
+        const size_t bytes = SampleAllocator::MaxClassSize + 1;
+        const SampleAllocatorStats before = allocator.GetStats();
+
+        void* data = allocator.Allocate(bytes, DefaultSampleGroup);
+        ASSERT_NE(data, nullptr);
+        const SampleAllocatorStats during = allocator.GetStats();
+        EXPECT_EQ(during.m_largeBytes, before.m_largeBytes + bytes);
+        EXPECT_EQ(during.m_largeAllocations, before.m_largeAllocations + 1);
+        EXPECT_EQ(during.m_slabUsedBytes, before.m_slabUsedBytes);
+        EXPECT_EQ(during.m_slabs, before.m_slabs);
+
+        allocator.Free(data, bytes, DefaultSampleGroup);
+        const SampleAllocatorStats after = allocator.GetStats();
+        EXPECT_EQ(after.m_largeBytes, before.m_largeBytes);
+        EXPECT_EQ(after.m_largeAllocations, before.m_largeAllocations);
+    }
+
+    TEST_F(SampleAllocatorTest, Free_BlockIsHandedOutAgain)
+    {
+        SampleAllocator& allocator = SampleAllocator::Get();
+        constexpr size_t Bytes = 4000;
+
+        void* first = allocator.Allocate(Bytes, DefaultSampleGroup);
+        void* second = allocator.Allocate(Bytes, DefaultSampleGroup);
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_NE(first, second);
+
+        allocator.Free(first, Bytes, DefaultSampleGroup);
+        void* third = allocator.Allocate(Bytes, DefaultSampleGroup);
+        EXPECT_EQ(third, first);
+
+        allocator.Free(second, Bytes, DefaultSampleGroup);
+        allocator.Free(third, Bytes, DefaultSampleGroup);
+    }
+
+    //The two largest classes have few blocks per slab and nothing else in the tests keeps them, so each slab below holds one block.
+    TEST_F(SampleAllocatorTest, EmptySlab_IsKeptAsSpareThenReleased)
+    {
+        SampleAllocator& allocator = SampleAllocator::Get();
+        constexpr size_t LargestBytes = SampleAllocator::MaxClassSize;
+        constexpr size_t SecondBytes = SampleAllocator::MaxClassSize / 4 * 3;
+
+        //Emptying a slab leaves it as the spare if there wasn't one.
+        allocator.Free(allocator.Allocate(LargestBytes, DefaultSampleGroup), LargestBytes, DefaultSampleGroup);
+        const AZ::u32 slabs = allocator.GetStats().m_slabs;
+
+        //A class with no slab of its own takes the spare before asking the OS.
+        void* spareBlock = allocator.Allocate(SecondBytes, DefaultSampleGroup);
+        ASSERT_NE(spareBlock, nullptr);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs);
+
+        //With the spare taken the next class needs a new slab.
+        void* newBlock = allocator.Allocate(LargestBytes, DefaultSampleGroup);
+        ASSERT_NE(newBlock, nullptr);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs + 1);
+
+        //The first slab to empty becomes the spare and stays allocated.
+        allocator.Free(spareBlock, SecondBytes, DefaultSampleGroup);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs + 1);
+
+        //The second goes back to the OS since there's already a spare.
+        allocator.Free(newBlock, LargestBytes, DefaultSampleGroup);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs);
+
+        //And the spare is reused by whichever class next needs a slab.
+        void* reused = allocator.Allocate(LargestBytes, DefaultSampleGroup);
+        EXPECT_EQ(reused, spareBlock);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs);
+        allocator.Free(reused, LargestBytes, DefaultSampleGroup);
+        EXPECT_EQ(allocator.GetStats().m_slabs, slabs);
+    }
+
+    TEST_F(SampleAllocatorTest, GroupStats_TrackBytesAndPeak)
+    {
+        SampleAllocator& allocator = SampleAllocator::Get();
+        EXPECT_EQ(allocator.GetGroup(""), DefaultSampleGroup);
+
+        const SampleGroupId group = allocator.GetGroup("SampleAllocatorTest");
+        EXPECT_NE(group, DefaultSampleGroup);
+        EXPECT_EQ(allocator.GetGroup("SampleAllocatorTest"), group);
+        const SampleGroupStats before = GetGroupStats(group);
+        EXPECT_EQ(before.m_name, "SampleAllocatorTest");
+        const AZ::u64 unnamedBytes = GetGroupStats(DefaultSampleGroup).m_bytes;
+
+        void* small = allocator.Allocate(3000, group);
+        void* large = allocator.Allocate(SampleAllocator::MaxClassSize * 2, group);
+        const SampleGroupStats during = GetGroupStats(group);
+        const AZ::u64 bothBytes = before.m_bytes + 3000 + SampleAllocator::MaxClassSize * 2;
+        EXPECT_EQ(during.m_bytes, bothBytes);
+        EXPECT_EQ(during.m_allocations, before.m_allocations + 2);
+        EXPECT_EQ(during.m_peakBytes, AZStd::max(before.m_peakBytes, bothBytes));
+        EXPECT_EQ(GetGroupStats(DefaultSampleGroup).m_bytes, unnamedBytes);
+
+        //Freeing lowers the bytes but not the peak.
+        allocator.Free(large, SampleAllocator::MaxClassSize * 2, group);
+        const SampleGroupStats afterFree = GetGroupStats(group);
+        EXPECT_EQ(afterFree.m_bytes, before.m_bytes + 3000);
+        EXPECT_EQ(afterFree.m_allocations, before.m_allocations + 1);
+        EXPECT_EQ(afterFree.m_peakBytes, during.m_peakBytes);
+
+        allocator.Free(small, 3000, group);
+        const SampleGroupStats after = GetGroupStats(group);
+        EXPECT_EQ(after.m_bytes, before.m_bytes);
+        EXPECT_EQ(after.m_allocations, before.m_allocations);
+    }
+}
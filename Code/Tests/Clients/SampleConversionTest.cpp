@@ -0,0 +1,162 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SampleConversion.h"
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzTest/AzTest.h>
+
+#include <cmath>
+#include <cstring>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //Every 16 bit pattern a precision can hold, Half skips infinity and NaN since samples are never either.
+    AZStd::vector<AZ::u16> GetEveryPattern(SamplePrecision precision)
+    {
+        AZStd::vector<AZ::u16> patterns;
+        for (AZ::u32 bits = 0; bits <= 0xffff; ++bits)
+        {
+            if (precision == SamplePrecision::Half && (bits & 0x7c00) == 0x7c00)
+            {
+                continue;
+            }
+            patterns.push_back(static_cast<AZ::u16>(bits));
+        }
+        return patterns;
+    }
+
+    class SampleConversionTest
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<SamplePrecision>
+    {
+    };
+
+    //Whole buffers take the SIMD path, a sample at a time only ever reaches the scalar tail.
+    TEST_P(SampleConversionTest, Unpack_SimdMatchesScalar)
+    {
+        const SamplePrecision precision = GetParam();
+        const AZStd::vector<AZ::u16> patterns = GetEveryPattern(precision);
+
+        AZStd::vector<float> simd(patterns.size());
+        UnpackSamples(precision, patterns.data(), simd.data(), patterns.size());
+
+        for (size_t i = 0; i < patterns.size(); ++i)
+        {
+            float scalar = 0.0f;
+            UnpackSamples(precision, patterns.data() + i, &scalar, 1);
+            ASSERT_EQ(memcmp(&scalar, &simd[i], sizeof(float)), 0) << "pattern 0x" << std::hex << patterns[i];
+        }
+    }
+
+    TEST_P(SampleConversionTest, PackUnpack_RoundTripsEveryPattern)
+    {
+        const SamplePrecision precision = GetParam();
+        AZStd::vector<AZ::u16> patterns = GetEveryPattern(precision);
+        if (precision == SamplePrecision::Int16)
+        {
+            //-32768 is below -1 and packs back as -32767.
+            patterns.erase(AZStd::remove(patterns.begin(), patterns.end(), static_cast<AZ::u16>(0x8000)), patterns.end());
+        }
+
+        AZStd::vector<float> unpacked(patterns.size());
+        AZStd::vector<AZ::u16> repacked(patterns.size());
+        UnpackSamples(precision, patterns.data(), unpacked.data(), patterns.size());
+        PackSamples(precision, unpacked.data(), repacked.data(), patterns.size());
+
+        for (size_t i = 0; i < patterns.size(); ++i)
+        {
+            ASSERT_EQ(repacked[i], patterns[i]) << "pattern 0x" << std::hex << patterns[i];
+        }
+    }
+
+    TEST_P(SampleConversionTest, Pack_ErrorIsWithinHalfAStep)
+    {
+        const SamplePrecision precision = GetParam();
+        constexpr size_t Count = 100003;
+        AZStd::vector<float> samples(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            samples[i] = std::sin(static_cast<float>(i) * 0.0137f) * 0.999f;
+        }
+
+        AZStd::vector<AZ::u16> packed(Count);
+        AZStd::vector<float> unpacked(Count);
+        PackSamples(precision, samples.data(), packed.data(), Count);
+        UnpackSamples(precision, packed.data(), unpacked.data(), Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            //Half has 11 significant bits, Int16 steps are 1/32767 everywhere. Unpacking can add a float rounding on top.
+            const float step = precision == SamplePrecision::Int16 ? 1.0f / 32767.0f
+                : std::ldexp(1.0f, std::ilogb(AZStd::max(std::fabs(samples[i]), 6.1035156e-05f)) - 10);
+            ASSERT_LE(std::fabs(unpacked[i] - samples[i]), step * 0.5f + 1e-7f) << "sample " << samples[i];
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(Precisions, SampleConversionTest, ::testing::Values(SamplePrecision::Int16, SamplePrecision::Half));
+
+#if defined(HAVE_BENCHMARK)
+    //One render quantum of stereo, what CompactSoundSource expands per voice on the audio thread.
+    constexpr size_t QuantumSamples = 128 * 2;
+
+    void UnpackBenchmark(benchmark::State& state, SamplePrecision precision, size_t chunk)
+    {
+        AZStd::vector<float> samples(QuantumSamples);
+        for (size_t i = 0; i < QuantumSamples; ++i)
+        {
+            samples[i] = std::sin(static_cast<float>(i) * 0.05f) * 0.5f;
+        }
+        AZStd::vector<AZ::u16> packed(QuantumSamples);
+        PackSamples(precision, samples.data(), packed.data(), QuantumSamples);
+
+        AZStd::vector<float> out(QuantumSamples);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            //A chunk of 1 keeps every sample on the scalar path, for comparison with the SIMD one.
+            for (size_t i = 0; i < QuantumSamples; i += chunk)
+            {
+                UnpackSamples(precision, packed.data() + i, out.data() + i, chunk);
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * QuantumSamples);
+    }
+
+    void PackBenchmark(benchmark::State& state, SamplePrecision precision)
+    {
+        AZStd::vector<float> samples(QuantumSamples);
+        for (size_t i = 0; i < QuantumSamples; ++i)
+        {
+            samples[i] = std::sin(static_cast<float>(i) * 0.05f) * 0.5f;
+        }
+
+        AZStd::vector<AZ::u16> packed(QuantumSamples);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            PackSamples(precision, samples.data(), packed.data(), QuantumSamples);
+            benchmark::DoNotOptimize(packed.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * QuantumSamples);
+    }
+
+    BENCHMARK_CAPTURE(UnpackBenchmark, Int16, SamplePrecision::Int16, QuantumSamples);
+    BENCHMARK_CAPTURE(UnpackBenchmark, Int16Scalar, SamplePrecision::Int16, 1);
+    BENCHMARK_CAPTURE(UnpackBenchmark, Half, SamplePrecision::Half, QuantumSamples);
+    BENCHMARK_CAPTURE(UnpackBenchmark, HalfScalar, SamplePrecision::Half, 1);
+    BENCHMARK_CAPTURE(PackBenchmark, Int16, SamplePrecision::Int16);
+    BENCHMARK_CAPTURE(PackBenchmark, Half, SamplePrecision::Half);
+#endif
+}
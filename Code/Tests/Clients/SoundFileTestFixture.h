@@ -0,0 +1,66 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    //Local file IO over a temporary directory that's removed again after each test, @user@ points into it.
+    class SoundFileTestFixture
+        : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+
+            m_priorFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(m_fileIO.get());
+            m_fileIO->SetAlias("@user@", GetTempPath("user").c_str());
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_fileIO.reset();
+            AZ::IO::FileIOBase::SetInstance(m_priorFileIO);
+            m_tempDirectory.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::string GetTempPath(const char* relativePath) const
+        {
+            return AZStd::string::format("%s/%s", m_tempDirectory->GetDirectory(), relativePath);
+        }
+
+        //Writes bytes to path, replacing whatever was there.
+        bool WriteTestFile(const AZStd::string& path, const void* data, AZ::u64 size) const
+        {
+            AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+            return file.IsOpen() && file.Write(size, data) == size;
+        }
+
+        bool Exists(const AZStd::string& path) const
+        {
+            return m_fileIO->Exists(path.c_str());
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIO;
+        AZ::IO::FileIOBase* m_priorFileIO = nullptr;
+    };
+}
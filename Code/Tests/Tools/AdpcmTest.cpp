@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBuilderTestFixture.h"
+
+#include "Clients/Adpcm.h"
+#include "Tools/SoundAssetBuilder.h"
+
+#include <AzTest/AzTest.h>
+
+#include <cmath>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    struct AdpcmLayout
+    {
+        int m_channels;
+        AZ::u64 m_frames;
+    };
+
+    std::ostream& operator<<(std::ostream& stream, const AdpcmLayout& layout)
+    {
+        return stream << layout.m_channels << "ch " << layout.m_frames << " frames";
+    }
+
+    //The first block starts from the smallest step and takes a few samples to catch up with the signal, after that every sample is this close.
+    constexpr float AdpcmMaxError = 0.08f;
+    //Over the whole sound, the test source measures about 33dB.
+    constexpr double AdpcmMinSnrDb = 30.0;
+
+    class AdpcmTest
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<AdpcmLayout>
+    {
+    protected:
+        //The test source cut to exactly the frames asked for, so the last block can be a partial one.
+        static std::unique_ptr<nqr::AudioData> CreateSource(const AdpcmLayout& layout)
+        {
+            std::unique_ptr<nqr::AudioData> audioData = CreateTestSource(layout.m_channels, 48000, layout.m_frames / 48000.0f + 0.01f);
+            audioData->samples.resize(layout.m_frames * layout.m_channels);
+            return audioData;
+        }
+
+        //Decodes what CompressAdpcm wrote back to interleaved, reading each channel's blocks from where the layout says they are.
+        static AZStd::vector<float> Decode(const AZStd::vector<AZ::u8>& payload, int channels, AZ::u64 frames)
+        {
+            AZStd::vector<float> samples(frames * channels);
+            float block[Adpcm::BlockFrames];
+            for (AZ::u64 b = 0; b < Adpcm::GetBlockCount(frames); ++b)
+            {
+                for (int ch = 0; ch < channels; ++ch)
+                {
+                    Adpcm::DecodeBlock(payload.data() + (b * channels + ch) * Adpcm::BlockSize, block);
+                    const AZ::u64 start = b * Adpcm::BlockFrames;
+                    for (AZ::u64 i = 0; i < Adpcm::BlockFrames && start + i < frames; ++i)
+                    {
+                        samples[(start + i) * channels + ch] = block[i];
+                    }
+                }
+            }
+            return samples;
+        }
+    };
+
+    TEST_P(AdpcmTest, CompressAdpcm_PayloadHoldsEveryBlock)
+    {
+        const AdpcmLayout layout = GetParam();
+        std::unique_ptr<nqr::AudioData> source = CreateSource(layout);
+        const AZStd::vector<AZ::u8> payload = SoundAssetBuilder().CompressAdpcm(source.get());
+
+        const AZ::u64 blocks = (layout.m_frames + Adpcm::BlockFrames - 1) / Adpcm::BlockFrames;
+        EXPECT_EQ(Adpcm::GetBlockCount(layout.m_frames), blocks);
+        EXPECT_EQ(payload.size(), blocks * layout.m_channels * Adpcm::BlockSize);
+        EXPECT_EQ(payload.size(), Adpcm::GetPayloadSize(layout.m_channels, layout.m_frames));
+    }
+
+    //Including the frames of a partial last block, the padding past them is never compared.
+    TEST_P(AdpcmTest, RoundTrip_StaysWithinTheErrorBound)
+    {
+        const AdpcmLayout layout = GetParam();
+        std::unique_ptr<nqr::AudioData> source = CreateSource(layout);
+        const AZStd::vector<AZ::u8> payload = SoundAssetBuilder().CompressAdpcm(source.get());
+        const AZStd::vector<float> decoded = Decode(payload, layout.m_channels, layout.m_frames);
+
+        double signal = 0.0;
+        double noise = 0.0;
+        for (AZ::u64 frame = 0; frame < layout.m_frames; ++frame)
+        {
+            for (int ch = 0; ch < layout.m_channels; ++ch)
+            {
+                const size_t i = frame * layout.m_channels + ch;
+                const double error = decoded[i] - source->samples[i];
+                signal += static_cast<double>(source->samples[i]) * source->samples[i];
+                noise += error * error;
+                if (frame >= Adpcm::BlockFrames)
+                {
+                    ASSERT_NEAR(decoded[i], source->samples[i], AdpcmMaxError) << "channel " << ch << " frame " << frame;
+                }
+            }
+        }
+        EXPECT_GT(10.0 * std::log10(signal / noise), AdpcmMinSnrDb);
+    }
+
+    //Each channel is held at its own level, so a block read from the wrong place in the payload shows up as the wrong level.
+    TEST_P(AdpcmTest, CompressAdpcm_InterleavesChannelsPerBlock)
+    {
+        const AdpcmLayout layout = GetParam();
+        std::unique_ptr<nqr::AudioData> source = CreateSource(layout);
+        for (AZ::u64 frame = 0; frame < layout.m_frames; ++frame)
+        {
+            for (int ch = 0; ch < layout.m_channels; ++ch)
+            {
+                source->samples[frame * layout.m_channels + ch] = -0.6f + 0.2f * ch;
+            }
+        }
+
+        const AZStd::vector<AZ::u8> payload = SoundAssetBuilder().CompressAdpcm(source.get());
+        float block[Adpcm::BlockFrames];
+        for (AZ::u64 b = 0; b < Adpcm::GetBlockCount(layout.m_frames); ++b)
+        {
+            for (int ch = 0; ch < layout.m_channels; ++ch)
+            {
+                Adpcm::DecodeBlock(payload.data() + (b * layout.m_channels + ch) * Adpcm::BlockSize, block);
+                //Past the end of a partial block the encoder was fed silence, the level only holds up to there.
+                const AZ::u64 frames = AZStd::min<AZ::u64>(Adpcm::BlockFrames, layout.m_frames - b * Adpcm::BlockFrames);
+                for (AZ::u64 i = 0; i < frames; ++i)
+                {
+                    ASSERT_NEAR(block[i], -0.6f + 0.2f * ch, 1e-3f) << "block " << b << " channel " << ch << " frame " << i;
+                }
+            }
+        }
+    }
+
+    INSTANTIATE_TEST_CASE_P(Layouts, AdpcmTest, ::testing::Values(
+        AdpcmLayout{1, Adpcm::BlockFrames * 40},
+        AdpcmLayout{2, Adpcm::BlockFrames * 20 + 77},
+        AdpcmLayout{6, Adpcm::BlockFrames * 8 + 1}));
+}
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SoundFileTestFixture.h"
+#include "SoundBuilderTestFixture.h"
+
+#include "Tools/DecodedSourceCache.h"
+
+#include <AzTest/AzTest.h>
+
+#include <chrono>
+#include <filesystem>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    class DecodedSourceCacheTest
+        : public SoundFileTestFixture
+    {
+    protected:
+        //Where the entry for sourceHash is on disk.
+        static std::filesystem::path GetEntryFile(const AZ::Uuid& sourceHash)
+        {
+            return ResolveTestPath(DecodedSourceCache::GetEntryPath(sourceHash).c_str());
+        }
+
+        static std::filesystem::path ResolveTestPath(const char* path)
+        {
+            char resolvedPath[AZ_MAX_PATH_LEN] = {};
+            EXPECT_TRUE(AZ::IO::FileIOBase::GetInstance()->ResolvePath(path, resolvedPath, sizeof(resolvedPath)));
+            return resolvedPath;
+        }
+
+        //Makes a file look as if it was last written age ago.
+        static void SetAge(const std::filesystem::path& path, std::chrono::seconds age)
+        {
+            std::error_code error;
+            std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now() - age, error);
+            EXPECT_FALSE(error) << path.string();
+        }
+    };
+
+    TEST_F(DecodedSourceCacheTest, Store_ThenLoadGivesTheSameSource)
+    {
+        const AZ::Uuid sourceHash = AZ::Uuid::CreateName("DecodedSourceCacheTest");
+        std::unique_ptr<nqr::AudioData> source = CreateTestSource(2, 22050, 1.5f);
+
+        nqr::AudioData missed;
+        EXPECT_FALSE(DecodedSourceCache::Load(sourceHash, missed));
+
+        DecodedSourceCache::Store(sourceHash, *source);
+        nqr::AudioData loaded;
+        ASSERT_TRUE(DecodedSourceCache::Load(sourceHash, loaded));
+        EXPECT_EQ(loaded.channelCount, source->channelCount);
+        EXPECT_EQ(loaded.sampleRate, source->sampleRate);
+        EXPECT_DOUBLE_EQ(loaded.lengthSeconds, source->lengthSeconds);
+        EXPECT_TRUE(loaded.samples == source->samples);
+
+        //Nothing else is written next to the entry.
+        int files = 0;
+        AZ::IO::FileIOBase::GetInstance()->FindFiles(DecodedSourceCache::Directory, "*", [&files](const char*)
+        {
+            ++files;
+            return true;
+        });
+        EXPECT_EQ(files, 1);
+    }
+
+    //Each entry is the same size, the cap fits two of them.
+    TEST_F(DecodedSourceCacheTest, Store_PastTheCap_EvictsTheOldestModified)
+    {
+        std::unique_ptr<nqr::AudioData> source = CreateTestSource(1, 8000, 1.0f);
+        const AZ::Uuid first = AZ::Uuid::CreateName("DecodedSourceCacheTest.First");
+        const AZ::Uuid second = AZ::Uuid::CreateName("DecodedSourceCacheTest.Second");
+        const AZ::Uuid third = AZ::Uuid::CreateName("DecodedSourceCacheTest.Third");
+
+        DecodedSourceCache::Store(first, *source);
+        DecodedSourceCache::Store(second, *source);
+        const AZ::u64 entryBytes = std::filesystem::file_size(GetEntryFile(first));
+        const AZ::u64 maxSizeBytes = entryBytes * 2;
+
+        //The first was written before the second, but loading it makes it the more recently used.
+        SetAge(GetEntryFile(first), std::chrono::hours(2));
+        SetAge(GetEntryFile(second), std::chrono::hours(1));
+        nqr::AudioData loaded;
+        ASSERT_TRUE(DecodedSourceCache::Load(first, loaded));
+
+        DecodedSourceCache::Store(third, *source, maxSizeBytes);
+        EXPECT_TRUE(std::filesystem::exists(GetEntryFile(first)));
+        EXPECT_FALSE(std::filesystem::exists(GetEntryFile(second)));
+        EXPECT_TRUE(std::filesystem::exists(GetEntryFile(third)));
+
+        //Without a load in between the oldest goes, here the first again.
+        SetAge(GetEntryFile(first), std::chrono::hours(2));
+        DecodedSourceCache::Store(second, *source, maxSizeBytes);
+        EXPECT_FALSE(std::filesystem::exists(GetEntryFile(first)));
+        EXPECT_TRUE(std::filesystem::exists(GetEntryFile(second)));
+        EXPECT_TRUE(std::filesystem::exists(GetEntryFile(third)));
+    }
+
+    TEST_F(DecodedSourceCacheTest, Store_RemovesStaleTempFiles)
+    {
+        std::unique_ptr<nqr::AudioData> source = CreateTestSource(1, 8000, 0.5f);
+        ASSERT_TRUE(AZ::IO::FileIOBase::GetInstance()->CreatePath(DecodedSourceCache::Directory));
+
+        //One left by a builder that died long ago, one still being written by another.
+        const AZStd::string staleTemp = AZStd::string::format("%s/stale.src.0.tmp", DecodedSourceCache::Directory);
+        const AZStd::string writingTemp = AZStd::string::format("%s/writing.src.0.tmp", DecodedSourceCache::Directory);
+        const AZ::u32 partial = 0;
+        ASSERT_TRUE(WriteTestFile(staleTemp, &partial, sizeof(partial)));
+        ASSERT_TRUE(WriteTestFile(writingTemp, &partial, sizeof(partial)));
+        SetAge(ResolveTestPath(staleTemp.c_str()), std::chrono::hours(2));
+
+        DecodedSourceCache::Store(AZ::Uuid::CreateName("DecodedSourceCacheTest"), *source);
+        EXPECT_FALSE(Exists(staleTemp));
+        EXPECT_TRUE(Exists(writingTemp));
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBuilderTestFixture.h"
+
+#include "BuilderSettings/SoundAssetSettings.h"
+#include "Clients/Decoders/OpusPacketDecoder.h"
+#include "Tools/SoundAssetBuilder.h"
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzTest/AzTest.h>
+
+#include <cmath>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //Not a whole number of packets, so the last one is padded and has to be trimmed.
+    constexpr float OpusSourceSeconds = 10.01f;
+    constexpr int OpusChannels = 2;
+    //How far either way the alignment check looks for a better match.
+    constexpr int AlignmentSearchFrames = 64;
+
+    class OpusRoundTripTest
+        : public SoundBuilderTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            SoundBuilderTestFixture::SetUp();
+            m_source = CreateTestSource(OpusChannels, 48000, OpusSourceSeconds);
+
+            SoundAssetBuilderSettings settings{};
+            settings.m_format = AudioImportFormat::Opus;
+            settings.m_quality = 1.0f;
+            m_payload = SoundAssetBuilder().CompressOpus(m_source.get(), settings, m_segments, m_seekTable);
+        }
+
+        void TearDown() override
+        {
+            m_source.reset();
+            m_payload = {};
+            m_segments = {};
+            m_seekTable = {};
+            SoundBuilderTestFixture::TearDown();
+        }
+
+        AZ::u64 GetSourceFrames() const
+        {
+            return m_source->samples.size() / OpusChannels;
+        }
+
+        //Decodes up to frames into planar, from wherever the decoder is, returns how many it got.
+        static AZ::u64 DecodePlanar(OpusPacketDecoder& decoder, AZStd::vector<float>& planar, AZ::u64 frames)
+        {
+            planar.assign(frames * OpusChannels, 0.0f);
+            AZ::u64 decoded = 0;
+            while (decoded < frames)
+            {
+                float* channels[OpusChannels] = {planar.data() + decoded, planar.data() + frames + decoded};
+                const int count = decoder.Decode(channels, static_cast<int>(AZStd::min<AZ::u64>(1024, frames - decoded)));
+                if (count <= 0)
+                {
+                    break;
+                }
+                decoded += count;
+            }
+            return decoded;
+        }
+
+        std::unique_ptr<nqr::AudioData> m_source;
+        AZStd::vector<AZ::u8> m_payload;
+        AZStd::vector<SoundSegment> m_segments;
+        AZStd::vector<SoundSegment> m_seekTable;
+    };
+
+    //The encoder delay is dropped from the front and the padding of the last packet from the back.
+    TEST_F(OpusRoundTripTest, Decode_GivesTheSourceLength)
+    {
+        ASSERT_FALSE(m_payload.empty());
+        AZ::IO::MemoryStream stream(m_payload.data(), m_payload.size());
+        OpusPacketDecoder decoder;
+        ASSERT_TRUE(decoder.Open(&stream, m_payload.size()));
+        EXPECT_EQ(decoder.GetChannels(), OpusChannels);
+        EXPECT_EQ(decoder.GetSampleRate(), 48000);
+
+        //Asks for more than there is, the decoder has to stop at the source length on its own.
+        AZStd::vector<float> decoded;
+        EXPECT_EQ(DecodePlanar(decoder, decoded, GetSourceFrames() + 4800), GetSourceFrames());
+        EXPECT_TRUE(decoder.IsEndOfStream());
+    }
+
+    //With the pre-skip trimmed the output lines up with the source, any other offset matches worse.
+    TEST_F(OpusRoundTripTest, Decode_IsAlignedWithTheSource)
+    {
+        AZ::IO::MemoryStream stream(m_payload.data(), m_payload.size());
+        OpusPacketDecoder decoder;
+        ASSERT_TRUE(decoder.Open(&stream, m_payload.size()));
+        const AZ::u64 frames = GetSourceFrames();
+        AZStd::vector<float> decoded;
+        ASSERT_EQ(DecodePlanar(decoder, decoded, frames), frames);
+
+        //A second from the middle, away from the start where the codec is still settling.
+        const AZ::u64 begin = frames / 2;
+        const AZ::u64 end = begin + 48000;
+        int bestLag = 0;
+        double bestCorrelation = -1.0;
+        double zeroLagCorrelation = 0.0;
+        for (int lag = -AlignmentSearchFrames; lag <= AlignmentSearchFrames; ++lag)
+        {
+            double product = 0.0;
+            double sourceEnergy = 0.0;
+            double decodedEnergy = 0.0;
+            for (AZ::u64 i = begin; i < end; ++i)
+            {
+                const double source = m_source->samples[i * OpusChannels];
+                const double output = decoded[i + lag];
+                product += source * output;
+                sourceEnergy += source * source;
+                decodedEnergy += output * output;
+            }
+            const double correlation = product / std::sqrt(sourceEnergy * decodedEnergy);
+            if (correlation > bestCorrelation)
+            {
+                bestCorrelation = correlation;
+                bestLag = lag;
+            }
+            if (lag == 0)
+            {
+                zeroLagCorrelation = correlation;
+            }
+        }
+        EXPECT_EQ(bestLag, 0);
+        EXPECT_GT(zeroLagCorrelation, 0.9);
+    }
+
+    //Every restart point decodes, after its pre-roll, what decoding straight through gives at that frame.
+    TEST_F(OpusRoundTripTest, SeekToPage_MatchesDecodingStraightThrough)
+    {
+        ASSERT_FALSE(m_seekTable.empty());
+        ASSERT_FALSE(m_segments.empty());
+        AZ::IO::MemoryStream straightStream(m_payload.data(), m_payload.size());
+        OpusPacketDecoder straight;
+        ASSERT_TRUE(straight.Open(&straightStream, m_payload.size()));
+        const AZ::u64 frames = GetSourceFrames();
+        AZStd::vector<float> reference;
+        ASSERT_EQ(DecodePlanar(straight, reference, frames), frames);
+
+        //Restart points themselves, and frames part way into a page that are found through the table.
+        AZStd::vector<AZ::u64> targets;
+        for (const SoundSegment& point : m_seekTable)
+        {
+            targets.push_back(point.m_frame);
+        }
+        targets.push_back(frames / 3 + 17);
+        targets.push_back(frames - 2000);
+
+        constexpr AZ::u64 CompareFrames = 4800;
+        AZ::IO::MemoryStream stream(m_payload.data(), m_payload.size());
+        OpusPacketDecoder decoder;
+        ASSERT_TRUE(decoder.Open(&stream, m_payload.size()));
+        for (const AZ::u64 target : targets)
+        {
+            const SoundSegment* point = FindSeekPoint(m_seekTable, target);
+            ASSERT_NE(point, nullptr) << target;
+            ASSERT_TRUE(decoder.SeekToPage(point->m_byteOffset, target)) << target;
+
+            const AZ::u64 expected = AZStd::min(CompareFrames, frames - target);
+            AZStd::vector<float> seeked;
+            ASSERT_EQ(DecodePlanar(decoder, seeked, expected), expected) << target;
+
+            //The decoder state after a pre-roll is close to a continuous decode but not bit exact.
+            double error = 0.0;
+            for (int ch = 0; ch < OpusChannels; ++ch)
+            {
+                for (AZ::u64 i = 0; i < expected; ++i)
+                {
+                    const double difference = seeked[ch * expected + i] - reference[ch * frames + target + i];
+                    error += difference * difference;
+                }
+            }
+            EXPECT_LT(std::sqrt(error / (expected * OpusChannels)), 0.01) << target;
+        }
+    }
+}
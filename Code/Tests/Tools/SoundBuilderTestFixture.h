@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <libnyquist/Common.h>
+
+#include <cmath>
+
+namespace UnitTest
+{
+    //The job system the builder's parallel encode and the fast start tail decode run on.
+    class SoundTestJobSystem
+    {
+    public:
+        SoundTestJobSystem()
+        {
+            AZ::JobManagerDesc desc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(desc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        ~SoundTestJobSystem()
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    //Music-like source, a few partials per channel over quiet noise, the same every time it's made.
+    inline std::unique_ptr<nqr::AudioData> CreateTestSource(int channels, int sampleRate, float seconds)
+    {
+        auto audioData = std::make_unique<nqr::AudioData>();
+        audioData->channelCount = channels;
+        audioData->sampleRate = sampleRate;
+        audioData->sourceFormat = nqr::PCM_FLT;
+
+        const size_t frames = static_cast<size_t>(seconds * sampleRate);
+        audioData->lengthSeconds = static_cast<double>(frames) / sampleRate;
+        audioData->samples.resize(frames * channels);
+
+        AZ::u32 noise = 0x12345678;
+        for (size_t frame = 0; frame < frames; ++frame)
+        {
+            const double t = static_cast<double>(frame) / sampleRate;
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                noise = noise * 1664525u + 1013904223u;
+                const double partials = 0.4 * std::sin(2.0 * 3.14159265358979 * (220.0 + 110.0 * ch) * t)
+                    + 0.2 * std::sin(2.0 * 3.14159265358979 * 1375.0 * t + ch)
+                    + 0.1 * std::sin(2.0 * 3.14159265358979 * 6100.0 * t);
+                const double hiss = (static_cast<double>(noise >> 8) / 16777216.0 - 0.5) * 0.02;
+                audioData->samples[frame * channels + ch] = static_cast<float>(partials + hiss);
+            }
+        }
+        return audioData;
+    }
+
+    class SoundBuilderTestFixture
+        : public LeakDetectionFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_jobSystem = AZStd::make_unique<SoundTestJobSystem>();
+        }
+
+        void TearDown() override
+        {
+            m_jobSystem.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    private:
+        AZStd::unique_ptr<SoundTestJobSystem> m_jobSystem;
+    };
+}
@@ -0,0 +1,324 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "Clients/SoundFileTestFixture.h"
+#include "SoundBuilderTestFixture.h"
+
+#include "BuilderSettings/SoundAssetSettings.h"
+#include "BuilderSettings/SoundBuilderSettings.h"
+#include "BuilderSettings/SoundPresetSettings.h"
+#include "Clients/SoundAssetHandler.h"
+#include "Clients/SoundBankAssetHandler.h"
+#include "Tools/SoundAssetBuilder.h"
+#include "Tools/SoundBankBuilder.h"
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzTest/AzTest.h>
+#include <Sune/SoundAsset.h>
+#include <Sune/SoundBankAsset.h>
+#include <Sune/WaveformPeaks.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //Long enough that the Vorbis encode is split into parts on jobs.
+    constexpr float ProductSourceSeconds = 2.0f * SoundAssetBuilder::VorbisPartSeconds + 1.0f;
+    constexpr const char* ProductSoundFile = "Sounds/ProductTest.wav";
+    constexpr const char* ProductBankFile = "Sounds/ProductTest.soundbank";
+
+    const AZ::Uuid ProductSoundUuid = AZ::Uuid::CreateName("SoundProductTest.Sound");
+    const AZ::Uuid ProductBankUuid = AZ::Uuid::CreateName("SoundProductTest.Bank");
+
+    //The gem's settings cut down to the one preset every test sound gets, the format comes from each sound's .assetinfo.
+    constexpr const char* ProductBuilderConfig = R"({
+        "patterns": [{"pattern": "*", "preset": "Default"}],
+        "platforms": {"pc": {"enableStreaming": true, "parallelEncode": true}}
+    })";
+    constexpr const char* ProductPreset = R"({
+        "defaultSettings": {
+            "name": "Default",
+            "description": "SoundProductTest",
+            "format": "Vorbis",
+            "loadMethod": "DecodeOnLoad",
+            "quality": 0.5,
+            "precision": "Int16",
+            "sampleRate": 0,
+            "bitrate": 0,
+            "downmix": "Auto"
+        }
+    })";
+    constexpr const char* ProductBank = R"({"sounds": ["ProductTest.wav"]})";
+
+    //16 bit PCM WAV of the source, the way sounds usually arrive.
+    AZStd::vector<AZ::u8> CreateWavFile(const nqr::AudioData& audioData)
+    {
+        const AZ::u32 dataBytes = static_cast<AZ::u32>(audioData.samples.size() * sizeof(AZ::s16));
+        const AZ::u16 blockAlign = static_cast<AZ::u16>(audioData.channelCount * sizeof(AZ::s16));
+
+        AZStd::vector<AZ::u8> wav;
+        auto append = [&wav](const void* data, size_t size)
+        {
+            const AZ::u8* bytes = static_cast<const AZ::u8*>(data);
+            wav.insert(wav.end(), bytes, bytes + size);
+        };
+        auto appendU32 = [&append](AZ::u32 value) { append(&value, sizeof(value)); };
+        auto appendU16 = [&append](AZ::u16 value) { append(&value, sizeof(value)); };
+
+        append("RIFF", 4);
+        appendU32(36 + dataBytes);
+        append("WAVEfmt ", 8);
+        appendU32(16);
+        appendU16(1);
+        appendU16(static_cast<AZ::u16>(audioData.channelCount));
+        appendU32(static_cast<AZ::u32>(audioData.sampleRate));
+        appendU32(static_cast<AZ::u32>(audioData.sampleRate) * blockAlign);
+        appendU16(blockAlign);
+        appendU16(16);
+        append("data", 4);
+        appendU32(dataBytes);
+        for (const float sample : audioData.samples)
+        {
+            const AZ::s16 value = static_cast<AZ::s16>(std::lround(AZStd::clamp(sample, -1.0f, 1.0f) * 32767.0f));
+            append(&value, sizeof(value));
+        }
+        return wav;
+    }
+
+    //Banks are normally built with the asset processor running, here the one sound the bank holds has a fixed source uuid.
+    class ProductTestBankBuilder
+        : public SoundBankBuilder
+    {
+    public:
+        using SoundBankBuilder::SoundBankBuilder;
+
+    protected:
+        bool FindSoundSource(const AZStd::string& soundPath, AZ::Uuid& sourceUuid) const override
+        {
+            sourceUuid = ProductSoundUuid;
+            return soundPath.ends_with("ProductTest.wav");
+        }
+    };
+
+    //Runs the builders' ProcessJob the way the asset processor does, against a source, settings and asset manager of the test's own.
+    class SoundProductTest
+        : public SoundFileTestFixture
+        , public ::testing::WithParamInterface<AudioImportFormat>
+    {
+    protected:
+        void SetUp() override
+        {
+            SoundFileTestFixture::SetUp();
+            m_jobSystem = AZStd::make_unique<SoundTestJobSystem>();
+
+            AZ::ComponentApplication::Descriptor descriptor;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application = AZStd::make_unique<AZ::ComponentApplication>();
+            m_application->Create(descriptor, startupParameters);
+
+            //What the runtime and editor system components reflect for the builders.
+            AZ::SerializeContext* serializeContext = m_application->GetSerializeContext();
+            SoundAsset::Reflect(serializeContext);
+            SoundBankAsset::Reflect(serializeContext);
+            SoundAssetSettings::Reflect(serializeContext);
+            SoundBuilderSettings::Reflect(serializeContext);
+            PatternMapping::Reflect(serializeContext);
+            SoundPresetSettings::Reflect(serializeContext);
+            MultiplatformSoundPreset::Reflect(serializeContext);
+            SoundBankSourceData::Reflect(serializeContext);
+
+            AZ::Data::AssetManager::Descriptor assetManagerDescriptor;
+            AZ::Data::AssetManager::Create(assetManagerDescriptor);
+            m_soundHandler = AZStd::make_unique<SoundAssetHandler>();
+            m_bankHandler = AZStd::make_unique<SoundBankAssetHandler>();
+
+            //The settings manager reads the gem and project config the first time it's used, both point at the test's config.
+            AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+            fileIO->SetAlias("@gemroot:Sune@", GetTempPath("gem").c_str());
+            fileIO->SetAlias("@projectroot@", GetTempPath("gem").c_str());
+            ASSERT_TRUE(WriteText(GetTempPath("gem/Config/SoundBuilder.json"), ProductBuilderConfig));
+            ASSERT_TRUE(WriteText(GetTempPath("gem/Config/Sune/Default.preset"), ProductPreset));
+
+            std::unique_ptr<nqr::AudioData> audioData = CreateTestSource(2, 48000, ProductSourceSeconds);
+            const AZStd::vector<AZ::u8> wav = CreateWavFile(*audioData);
+            ASSERT_TRUE(WriteText(GetSourcePath(ProductBankFile), ProductBank));
+            ASSERT_TRUE(WriteTestFile(GetSourcePath(ProductSoundFile), wav.data(), wav.size()));
+
+            SoundAssetSettings assetSettings;
+            assetSettings.m_formatOverride = GetParam();
+            ASSERT_TRUE(AZ::Utils::SaveObjectToFile(
+                GetSourcePath(ProductSoundFile) + ".assetinfo", AZ::DataStream::ST_XML, &assetSettings, serializeContext));
+        }
+
+        void TearDown() override
+        {
+            m_bankHandler.reset();
+            m_soundHandler.reset();
+            AZ::Data::AssetManager::Destroy();
+            m_application->Destroy();
+            m_application.reset();
+            m_jobSystem.reset();
+            SoundFileTestFixture::TearDown();
+        }
+
+        AZStd::string GetSourcePath(const char* sourceFile) const
+        {
+            return GetTempPath(AZStd::string::format("source/%s", sourceFile).c_str());
+        }
+
+        //Writes text to path, making the directories it's in first.
+        bool WriteText(const AZStd::string& path, const char* text) const
+        {
+            AZ::IO::FileIOBase::GetInstance()->CreatePath(AZ::IO::Path(path).ParentPath().String().c_str());
+            return WriteTestFile(path, text, strlen(text));
+        }
+
+        static AZStd::vector<AZ::u8> ReadTestFile(const AZStd::string& path)
+        {
+            AZStd::vector<AZ::u8> data;
+            AZ::IO::FileIOStream file(path.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+            if (file.IsOpen())
+            {
+                data.resize(file.GetLength());
+                EXPECT_EQ(file.Read(data.size(), data.data()), data.size());
+            }
+            return data;
+        }
+
+        //The request the asset processor would send, each run writes to a temp directory of its own.
+        AssetBuilderSDK::ProcessJobRequest CreateRequest(const char* sourceFile, const AZ::Uuid& sourceUuid, const char* run) const
+        {
+            AssetBuilderSDK::ProcessJobRequest request;
+            request.m_sourceFile = sourceFile;
+            request.m_fullPath = GetSourcePath(sourceFile);
+            request.m_sourceFileUUID = sourceUuid;
+            request.m_tempDirPath = GetTempPath(run);
+            request.m_platformInfo.m_identifier = "pc";
+            AZ::IO::FileIOBase::GetInstance()->CreatePath(request.m_tempDirPath.c_str());
+            return request;
+        }
+
+        //Reads back every product a job wrote, in the order it lists them.
+        AZStd::vector<AZStd::vector<AZ::u8>> ReadProducts(const AssetBuilderSDK::ProcessJobResponse& response) const
+        {
+            EXPECT_EQ(response.m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+            AZStd::vector<AZStd::vector<AZ::u8>> products;
+            for (const AssetBuilderSDK::JobProduct& product : response.m_outputProducts)
+            {
+                products.push_back(ReadTestFile(product.m_productFileName));
+                EXPECT_FALSE(products.back().empty()) << product.m_productFileName.c_str();
+            }
+            return products;
+        }
+
+        AZStd::vector<AZStd::vector<AZ::u8>> ProcessSound(const char* run) const
+        {
+            AssetBuilderSDK::ProcessJobResponse response;
+            m_soundBuilder.ProcessJob(CreateRequest(ProductSoundFile, ProductSoundUuid, run), response);
+
+            //The sound and then its waveform peaks.
+            EXPECT_EQ(response.m_outputProducts.size(), 2u);
+            if (response.m_outputProducts.size() == 2)
+            {
+                EXPECT_EQ(response.m_outputProducts[0].m_productAssetType, azrtti_typeid<SoundAsset>());
+                EXPECT_EQ(response.m_outputProducts[0].m_productSubID, SoundAsset::AssetSubId);
+                EXPECT_TRUE(response.m_outputProducts[0].m_productFileName.ends_with(SoundAsset::FileExtension));
+                EXPECT_EQ(response.m_outputProducts[1].m_productAssetType, azrtti_typeid<WaveformPeaks>());
+                EXPECT_TRUE(response.m_outputProducts[1].m_productFileName.ends_with(WaveformPeaks::FileExtension));
+            }
+            return ReadProducts(response);
+        }
+
+        AZStd::vector<AZ::u8> ProcessBank(const char* run) const
+        {
+            AssetBuilderSDK::ProcessJobResponse response;
+            m_bankBuilder.ProcessJob(CreateRequest(ProductBankFile, ProductBankUuid, run), response);
+
+            EXPECT_EQ(response.m_outputProducts.size(), 1u);
+            AZStd::vector<AZStd::vector<AZ::u8>> products = ReadProducts(response);
+            return products.empty() ? AZStd::vector<AZ::u8>() : AZStd::move(products[0]);
+        }
+
+        AZ::SerializeContext* GetSerializeContext() const
+        {
+            return m_application->GetSerializeContext();
+        }
+
+    private:
+        AZStd::unique_ptr<SoundTestJobSystem> m_jobSystem;
+        AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+        AZStd::unique_ptr<SoundAssetHandler> m_soundHandler;
+        AZStd::unique_ptr<SoundBankAssetHandler> m_bankHandler;
+        SoundAssetBuilder m_soundBuilder;
+        ProductTestBankBuilder m_bankBuilder{ m_soundBuilder };
+    };
+
+    //Build caches key products by their bytes, the same source has to give the same products every time it's built.
+    //The second build also takes its decode from the decoded source cache the first one filled.
+    TEST_P(SoundProductTest, ProcessJob_RebuildGivesIdenticalProducts)
+    {
+        const AZStd::vector<AZStd::vector<AZ::u8>> first = ProcessSound("first");
+        const AZStd::vector<AZStd::vector<AZ::u8>> second = ProcessSound("second");
+
+        ASSERT_EQ(first.size(), 2u);
+        ASSERT_EQ(second.size(), first.size());
+        for (size_t i = 0; i < first.size(); ++i)
+        {
+            ASSERT_FALSE(first[i].empty());
+            EXPECT_EQ(first[i].size(), second[i].size()) << "product " << i;
+            EXPECT_TRUE(first[i] == second[i]) << "product " << i;
+        }
+
+        //The header is what the job wrote for the format the .assetinfo asked for.
+        SoundAsset header;
+        AZ::IO::MemoryStream stream(first[0].data(), first[0].size());
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, header, GetSerializeContext()));
+        const AudioImportFormat format = GetParam();
+        EXPECT_EQ(header.m_importFormat, format);
+        EXPECT_EQ(header.m_channels, 2);
+        EXPECT_EQ(header.m_sampleRate, 48000);
+        EXPECT_EQ(header.m_totalSamples, static_cast<size_t>(ProductSourceSeconds * 48000) * 2);
+        EXPECT_FALSE(header.m_payloadHash.IsNull());
+    }
+
+    //A bank member is laid out exactly like the sound's own product and keeps its asset id.
+    TEST_P(SoundProductTest, BankProcessJob_RebuildGivesIdenticalProduct)
+    {
+        const AZStd::vector<AZStd::vector<AZ::u8>> sound = ProcessSound("sound");
+        const AZStd::vector<AZ::u8> first = ProcessBank("first");
+        const AZStd::vector<AZ::u8> second = ProcessBank("second");
+
+        ASSERT_EQ(sound.size(), 2u);
+        ASSERT_FALSE(first.empty());
+        EXPECT_EQ(first.size(), second.size());
+        EXPECT_TRUE(first == second);
+
+        SoundBankAsset bank;
+        AZ::IO::MemoryStream stream(first.data(), first.size());
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, bank, GetSerializeContext()));
+        ASSERT_EQ(bank.m_entries.size(), 1u);
+        const SoundBankEntry& entry = bank.m_entries[0];
+        EXPECT_EQ(entry.m_assetId, AZ::Data::AssetId(ProductSoundUuid, SoundAsset::AssetSubId));
+
+        const AZ::u64 dataOffset = AZ_SIZE_ALIGN_UP(stream.GetCurPos(), SoundBankAsset::MemberAlignment);
+        ASSERT_LE(dataOffset + entry.m_offset + entry.m_size, first.size());
+        const AZ::u8* member = first.data() + dataOffset + entry.m_offset;
+        EXPECT_TRUE(AZStd::vector<AZ::u8>(member, member + entry.m_size) == sound[0]);
+    }
+
+    INSTANTIATE_TEST_CASE_P(Formats, SoundProductTest,
+        ::testing::Values(AudioImportFormat::Vorbis, AudioImportFormat::Opus, AudioImportFormat::Adpcm, AudioImportFormat::Uncompressed));
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBuilderTestFixture.h"
+
+#include "BuilderSettings/SoundAssetSettings.h"
+#include "Tools/SoundAssetBuilder.h"
+
+#include <AzTest/AzTest.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //Long enough to be split into three parts.
+    constexpr float EncodeSourceSeconds = 3.0f * SoundAssetBuilder::VorbisPartSeconds;
+    constexpr AZ::u32 EncodeSerial = 1;
+
+    SoundAssetBuilderSettings GetEncodeSettings()
+    {
+        SoundAssetBuilderSettings settings;
+        settings.m_format = AudioImportFormat::Vorbis;
+        settings.m_loadMethod = AudioLoadMethod::DecodeOnDemand;
+        settings.m_quality = 0.5f;
+        return settings;
+    }
+
+    class VorbisEncodeTest
+        : public SoundBuilderTestFixture
+    {
+    };
+
+    //Where parts split doesn't depend on how many jobs ran, so encoding them at the same time changes nothing in the output.
+    TEST_F(VorbisEncodeTest, ParallelEncode_MatchesSerial)
+    {
+        std::unique_ptr<nqr::AudioData> audioData = CreateTestSource(2, 48000, EncodeSourceSeconds);
+        const SoundAssetBuilderSettings settings = GetEncodeSettings();
+        SoundAssetBuilder builder;
+
+        AZStd::vector<SoundSegment> serialSegments;
+        AZStd::vector<SoundSegment> serialSeekTable;
+        const AZStd::vector<AZ::u8> serialPayload =
+            builder.CompressVorbis(audioData.get(), settings, false, EncodeSerial, serialSegments, serialSeekTable);
+
+        AZStd::vector<SoundSegment> parallelSegments;
+        AZStd::vector<SoundSegment> parallelSeekTable;
+        const AZStd::vector<AZ::u8> parallelPayload =
+            builder.CompressVorbis(audioData.get(), settings, true, EncodeSerial, parallelSegments, parallelSeekTable);
+
+        ASSERT_FALSE(serialPayload.empty());
+        EXPECT_TRUE(parallelPayload == serialPayload);
+        ASSERT_EQ(parallelSegments.size(), serialSegments.size());
+        for (size_t i = 0; i < serialSegments.size(); ++i)
+        {
+            EXPECT_EQ(parallelSegments[i].m_byteOffset, serialSegments[i].m_byteOffset);
+            EXPECT_EQ(parallelSegments[i].m_frame, serialSegments[i].m_frame);
+        }
+        EXPECT_EQ(parallelSeekTable.size(), serialSeekTable.size());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class VorbisEncodeBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void Encode(benchmark::State& state, bool parallel)
+        {
+            SoundTestJobSystem jobSystem;
+            std::unique_ptr<nqr::AudioData> audioData = CreateTestSource(2, 48000, EncodeSourceSeconds);
+            const SoundAssetBuilderSettings settings = GetEncodeSettings();
+            SoundAssetBuilder builder;
+            AZStd::vector<SoundSegment> segments;
+            AZStd::vector<SoundSegment> seekTable;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                AZStd::vector<AZ::u8> payload = builder.CompressVorbis(audioData.get(), settings, parallel, EncodeSerial, segments, seekTable);
+                benchmark::DoNotOptimize(payload.data());
+            }
+
+            //Seconds of audio encoded per second, compare the two to see what the parts bought.
+            state.counters["AudioSecondsPerSecond"] = benchmark::Counter(
+                static_cast<double>(state.iterations()) * audioData->lengthSeconds, benchmark::Counter::kIsRate);
+        }
+    };
+
+    //A minute and a half of stereo, the three parts one after another and then on four workers.
+    BENCHMARK_F(VorbisEncodeBenchmark, Serial)(benchmark::State& state)
+    {
+        Encode(state, false);
+    }
+
+    BENCHMARK_F(VorbisEncodeBenchmark, Parallel)(benchmark::State& state)
+    {
+        Encode(state, true);
+    }
+#endif
+}
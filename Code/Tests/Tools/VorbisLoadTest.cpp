@@ -0,0 +1,400 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SoundBuilderTestFixture.h"
+
+#include "BuilderSettings/SoundAssetSettings.h"
+#include "Clients/Decoders/VorbisDecoder.h"
+#include "Clients/SampleAllocator.h"
+#include "Clients/SoundAssetHandler.h"
+#include "Tools/SoundAssetBuilder.h"
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+
+#include <cstring>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+using namespace Sune;
+
+namespace UnitTest
+{
+    //Counts how much the decoder asks for at once, a whole payload read would show up here.
+    class ReadSizeStream
+        : public AZ::IO::MemoryStream
+    {
+    public:
+        using AZ::IO::MemoryStream::MemoryStream;
+
+        AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override
+        {
+            m_largestRead = AZStd::max(m_largestRead, bytes);
+            return AZ::IO::MemoryStream::Read(bytes, oBuffer);
+        }
+
+        AZ::IO::SizeType m_largestRead = 0;
+    };
+
+    //A DecodeOnLoad Vorbis sound, without segments unless they're set on the asset, so the whole payload is decoded before LoadResidentSamples returns.
+    struct VorbisLoadSource
+    {
+        VorbisLoadSource(int channels, int sampleRate, float seconds)
+        {
+            std::unique_ptr<nqr::AudioData> audioData = CreateTestSource(channels, sampleRate, seconds);
+            SoundAssetBuilderSettings settings{};
+            settings.m_format = AudioImportFormat::Vorbis;
+            settings.m_loadMethod = AudioLoadMethod::DecodeOnLoad;
+            settings.m_quality = 0.5f;
+            settings.m_precision = SamplePrecision::Float32;
+
+            m_payload = SoundAssetBuilder().CompressVorbis(audioData.get(), settings, false, 1, m_segments, m_seekTable);
+            m_channels = channels;
+            m_sampleRate = sampleRate;
+            m_totalSamples = audioData->samples.size();
+        }
+
+        void PrepareAsset(SoundAsset& soundAsset, const char* presetName) const
+        {
+            soundAsset.m_importFormat = AudioImportFormat::Vorbis;
+            soundAsset.m_loadMethod = AudioLoadMethod::DecodeOnLoad;
+            soundAsset.m_precision = SamplePrecision::Float32;
+            soundAsset.m_channels = m_channels;
+            soundAsset.m_sampleRate = m_sampleRate;
+            soundAsset.m_totalSamples = m_totalSamples;
+            soundAsset.m_productSampleRate = m_sampleRate;
+            soundAsset.m_productTotalSamples = m_totalSamples;
+            soundAsset.m_payloadSize = m_payload.size();
+            soundAsset.m_presetName = presetName;
+        }
+
+        AZStd::vector<AZ::u8> m_payload;
+        AZStd::vector<SoundSegment> m_segments;
+        AZStd::vector<SoundSegment> m_seekTable;
+        int m_channels = 0;
+        int m_sampleRate = 0;
+        size_t m_totalSamples = 0;
+    };
+
+    AZ::u64 GetPeakSampleBytes(const char* presetName)
+    {
+        for (const SampleGroupStats& group : SampleAllocator::Get().GetGroupStats())
+        {
+            if (group.m_name == presetName)
+            {
+                return group.m_peakBytes;
+            }
+        }
+        return 0;
+    }
+
+    //The load as it was before decoding straight into the planar buffer, kept as the reference the benchmark compares against.
+    //The payload is read whole and copied again into ogg_sync, decoded into per-channel vectors reserved from a guess at the length,
+    //then copied once more into planar. Returns the most payload and sample bytes it held at once, 0 if the payload didn't decode.
+    AZ::u64 DecodeWithCopies(AZ::IO::GenericStream& stream, AZ::u64 payloadSize, AZStd::vector<float>& planar)
+    {
+        AZStd::vector<AZ::u8> fileBuffer(payloadSize);
+        if (stream.Read(payloadSize, fileBuffer.data()) != payloadSize)
+        {
+            return 0;
+        }
+
+        ogg_sync_state syncState;
+        ogg_stream_state streamState;
+        vorbis_info info;
+        vorbis_comment comment;
+        vorbis_dsp_state dspState;
+        vorbis_block block;
+        ogg_sync_init(&syncState);
+        vorbis_info_init(&info);
+        vorbis_comment_init(&comment);
+
+        char* buffer = ogg_sync_buffer(&syncState, static_cast<long>(payloadSize));
+        memcpy(buffer, fileBuffer.data(), payloadSize);
+        ogg_sync_wrote(&syncState, static_cast<long>(payloadSize));
+        fileBuffer = {};
+
+        AZStd::vector<AZStd::vector<float>> channelBuffers;
+        bool streamStarted = false;
+        bool synthesisStarted = false;
+        bool failed = false;
+        int headers = 0;
+        ogg_page page;
+        ogg_packet packet;
+        while (!failed && ogg_sync_pageout(&syncState, &page) == 1)
+        {
+            if (!streamStarted)
+            {
+                ogg_stream_init(&streamState, ogg_page_serialno(&page));
+                streamStarted = true;
+            }
+            ogg_stream_pagein(&streamState, &page);
+
+            while (!failed && ogg_stream_packetout(&streamState, &packet) == 1)
+            {
+                if (headers < 3)
+                {
+                    failed = vorbis_synthesis_headerin(&info, &comment, &packet) < 0;
+                    if (!failed && ++headers == 3)
+                    {
+                        vorbis_synthesis_init(&dspState, &info);
+                        vorbis_block_init(&dspState, &block);
+                        synthesisStarted = true;
+                        channelBuffers.resize(info.channels);
+                        for (AZStd::vector<float>& channel : channelBuffers)
+                        {
+                            channel.reserve(payloadSize * 8 / info.channels);
+                        }
+                    }
+                    continue;
+                }
+
+                if (vorbis_synthesis(&block, &packet) == 0)
+                {
+                    vorbis_synthesis_blockin(&dspState, &block);
+                }
+                float** pcm = nullptr;
+                int frames = 0;
+                while ((frames = vorbis_synthesis_pcmout(&dspState, &pcm)) > 0)
+                {
+                    for (int ch = 0; ch < info.channels; ++ch)
+                    {
+                        channelBuffers[ch].insert(channelBuffers[ch].end(), pcm[ch], pcm[ch] + frames);
+                    }
+                    vorbis_synthesis_read(&dspState, frames);
+                }
+            }
+        }
+
+        //The copy into planar is the peak, everything else is still held while it happens.
+        AZ::u64 peakBytes = 0;
+        if (!failed && synthesisStarted)
+        {
+            const size_t frames = channelBuffers[0].size();
+            planar.resize(frames * channelBuffers.size());
+            peakBytes = static_cast<AZ::u64>(syncState.storage) + planar.size() * sizeof(float);
+            for (size_t ch = 0; ch < channelBuffers.size(); ++ch)
+            {
+                memcpy(planar.data() + ch * frames, channelBuffers[ch].data(), frames * sizeof(float));
+                peakBytes += channelBuffers[ch].capacity() * sizeof(float);
+            }
+        }
+
+        if (synthesisStarted)
+        {
+            vorbis_block_clear(&block);
+            vorbis_dsp_clear(&dspState);
+        }
+        if (streamStarted)
+        {
+            ogg_stream_clear(&streamState);
+        }
+        ogg_sync_clear(&syncState);
+        vorbis_comment_clear(&comment);
+        vorbis_info_clear(&info);
+        return peakBytes;
+    }
+
+    //Planar frames [start, end) of the payload through one decoder, seeking to start through the seek table if it isn't 0.
+    bool DecodeStraight(const VorbisLoadSource& source, AZ::u64 start, AZ::u64 end, AZStd::vector<float>& planar)
+    {
+        AZ::IO::MemoryStream stream(source.m_payload.data(), source.m_payload.size());
+        VorbisDecoder decoder;
+        if (!decoder.Open(&stream, source.m_payload.size()))
+        {
+            return false;
+        }
+        if (start > 0)
+        {
+            const SoundSegment* seekPoint = FindSeekPoint(source.m_seekTable, start);
+            if (seekPoint == nullptr || !decoder.SeekToPage(seekPoint->m_byteOffset, start))
+            {
+                return false;
+            }
+        }
+
+        const size_t frames = static_cast<size_t>(end - start);
+        planar.resize(frames * source.m_channels);
+        AZStd::vector<float*> channels(source.m_channels);
+        for (int ch = 0; ch < source.m_channels; ++ch)
+        {
+            channels[ch] = planar.data() + ch * frames;
+        }
+        return decoder.Decode(channels.data(), static_cast<int>(frames)) == static_cast<int>(frames);
+    }
+
+    class VorbisLoadTest
+        : public SoundBuilderTestFixture
+    {
+    };
+
+    TEST_F(VorbisLoadTest, DecodeOnLoad_PeakMemoryIsThePcmOnce)
+    {
+        constexpr const char* PresetName = "VorbisLoadTest";
+        const VorbisLoadSource source(2, 48000, 20.0f);
+        ASSERT_FALSE(source.m_payload.empty());
+
+        SoundDataAsset soundAsset(aznew SoundAsset(), AZ::Data::AssetLoadBehavior::Default);
+        source.PrepareAsset(*soundAsset.Get(), PresetName);
+        ReadSizeStream stream(source.m_payload.data(), source.m_payload.size());
+        ASSERT_TRUE(SoundAssetHandler::LoadResidentSamples(soundAsset, stream));
+
+        //The planar samples are the only sample memory, allocated once at their final size.
+        const AZ::u64 pcmBytes = source.m_totalSamples * sizeof(float);
+        EXPECT_EQ(soundAsset->m_samples.size(), source.m_totalSamples);
+        EXPECT_EQ(GetPeakSampleBytes(PresetName), pcmBytes);
+        EXPECT_TRUE(soundAsset->IsFullyDecoded());
+
+        //The payload is fed to the decoder a chunk at a time, never buffered whole.
+        EXPECT_LE(stream.m_largestRead, VorbisDecoder::ReadChunkSize);
+
+        SoundAssetHandler::ReleaseResidentSamples(*soundAsset.Get());
+    }
+
+    //The reference the benchmark compares against decodes the same samples, so the two timings are of the same work.
+    TEST_F(VorbisLoadTest, DecodeOnLoad_MatchesWholePayloadDecode)
+    {
+        constexpr const char* PresetName = "VorbisLoadTest";
+        const VorbisLoadSource source(2, 48000, 5.0f);
+        ASSERT_FALSE(source.m_payload.empty());
+
+        SoundDataAsset soundAsset(aznew SoundAsset(), AZ::Data::AssetLoadBehavior::Default);
+        source.PrepareAsset(*soundAsset.Get(), PresetName);
+        AZ::IO::MemoryStream stream(source.m_payload.data(), source.m_payload.size());
+        ASSERT_TRUE(SoundAssetHandler::LoadResidentSamples(soundAsset, stream));
+
+        AZStd::vector<float> reference;
+        AZ::IO::MemoryStream referenceStream(source.m_payload.data(), source.m_payload.size());
+        ASSERT_GT(DecodeWithCopies(referenceStream, source.m_payload.size(), reference), 0u);
+
+        //Planar in both, the reference may run on past the length the header gives.
+        const size_t frames = source.m_totalSamples / source.m_channels;
+        const size_t referenceFrames = reference.size() / source.m_channels;
+        ASSERT_GE(referenceFrames, frames);
+        for (int ch = 0; ch < source.m_channels; ++ch)
+        {
+            for (size_t i = 0; i < frames; ++i)
+            {
+                ASSERT_EQ(soundAsset->m_samples.data()[ch * frames + i], reference[ch * referenceFrames + i]) << "channel " << ch << " frame " << i;
+            }
+        }
+
+        SoundAssetHandler::ReleaseResidentSamples(*soundAsset.Get());
+    }
+
+    //Long enough to be built in chained parts, loaded with its segments so everything after the first is decoded on the job system.
+    //Each segment restarts its own decoder at a page, the ones in later parts after the serial has changed.
+    TEST_F(VorbisLoadTest, ChainedSegmentedLoad_MatchesStraightDecode)
+    {
+        constexpr const char* PresetName = "VorbisLoadTest";
+        const VorbisLoadSource source(2, 48000, 2.0f * SoundAssetBuilder::VorbisPartSeconds + 10.0f);
+        ASSERT_FALSE(source.m_payload.empty());
+        ASSERT_GT(source.m_segments.size(), 2u * SoundAssetBuilder::VorbisPartSeconds / SoundAssetBuilder::SegmentSeconds);
+
+        SoundDataAsset soundAsset(aznew SoundAsset(), AZ::Data::AssetLoadBehavior::Default);
+        source.PrepareAsset(*soundAsset.Get(), PresetName);
+        soundAsset->m_segments = source.m_segments;
+        soundAsset->m_seekTable = source.m_seekTable;
+        AZ::IO::MemoryStream stream(source.m_payload.data(), source.m_payload.size());
+        ASSERT_TRUE(SoundAssetHandler::LoadResidentSamples(soundAsset, stream));
+
+        //Only the first segment is decoded on return, the rest finishes in the background.
+        const size_t frames = source.m_totalSamples / source.m_channels;
+        for (int wait = 0; wait < 600 && !soundAsset->IsFullyDecoded(); ++wait)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(100));
+        }
+        ASSERT_TRUE(soundAsset->IsFullyDecoded());
+        ASSERT_EQ(soundAsset->m_samples.size(), source.m_totalSamples);
+        EXPECT_EQ(soundAsset->m_totalSamples, source.m_totalSamples);
+
+        AZStd::vector<float> reference;
+        ASSERT_TRUE(DecodeStraight(source, 0, frames, reference));
+        for (int ch = 0; ch < source.m_channels; ++ch)
+        {
+            for (size_t i = 0; i < frames; ++i)
+            {
+                ASSERT_EQ(soundAsset->m_samples.data()[ch * frames + i], reference[ch * frames + i]) << "channel " << ch << " frame " << i;
+            }
+        }
+
+        //Seeking into the second part through the seek table lands on the same samples.
+        const AZ::u64 partFrames = static_cast<AZ::u64>(source.m_sampleRate) * SoundAssetBuilder::VorbisPartSeconds;
+        for (const AZ::u64 start : { partFrames + 4321, partFrames * 2 - 1000 })
+        {
+            const SoundSegment* seekPoint = FindSeekPoint(source.m_seekTable, start);
+            ASSERT_NE(seekPoint, nullptr);
+            EXPECT_GE(seekPoint->m_frame, partFrames - source.m_sampleRate);
+
+            const AZ::u64 end = AZStd::min<AZ::u64>(start + source.m_sampleRate, frames);
+            AZStd::vector<float> seeked;
+            ASSERT_TRUE(DecodeStraight(source, start, end, seeked)) << "seeking to " << start;
+            const size_t seekedFrames = static_cast<size_t>(end - start);
+            for (int ch = 0; ch < source.m_channels; ++ch)
+            {
+                for (size_t i = 0; i < seekedFrames; ++i)
+                {
+                    ASSERT_EQ(seeked[ch * seekedFrames + i], reference[ch * frames + start + i]) << "seeking to " << start << " channel " << ch << " frame " << i;
+                }
+            }
+        }
+
+        SoundAssetHandler::ReleaseResidentSamples(*soundAsset.Get());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class VorbisLoadBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    //Load time of a 20 second stereo sound, the counters show what the load kept resident at its peak.
+    BENCHMARK_F(VorbisLoadBenchmark, DecodeOnLoad)(benchmark::State& state)
+    {
+        constexpr const char* PresetName = "VorbisLoadBenchmark";
+        const VorbisLoadSource source(2, 48000, 20.0f);
+        AZ::IO::SizeType largestRead = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SoundDataAsset soundAsset(aznew SoundAsset(), AZ::Data::AssetLoadBehavior::Default);
+            source.PrepareAsset(*soundAsset.Get(), PresetName);
+            ReadSizeStream stream(source.m_payload.data(), source.m_payload.size());
+            SoundAssetHandler::LoadResidentSamples(soundAsset, stream);
+            largestRead = AZStd::max(largestRead, stream.m_largestRead);
+            SoundAssetHandler::ReleaseResidentSamples(*soundAsset.Get());
+        }
+
+        const double pcmBytes = static_cast<double>(source.m_totalSamples * sizeof(float));
+        state.counters["PeakSamplesPerPcm"] = static_cast<double>(GetPeakSampleBytes(PresetName)) / pcmBytes;
+        state.counters["LargestRead"] = static_cast<double>(largestRead);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(pcmBytes));
+    }
+
+    //The same sound through the old whole payload load, its counters sit next to DecodeOnLoad's for comparison.
+    BENCHMARK_F(VorbisLoadBenchmark, WholePayloadCopies)(benchmark::State& state)
+    {
+        const VorbisLoadSource source(2, 48000, 20.0f);
+        AZ::u64 peakBytes = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<float> planar;
+            AZ::IO::MemoryStream stream(source.m_payload.data(), source.m_payload.size());
+            peakBytes = AZStd::max(peakBytes, DecodeWithCopies(stream, source.m_payload.size(), planar));
+            benchmark::DoNotOptimize(planar.data());
+        }
+
+        const double pcmBytes = static_cast<double>(source.m_totalSamples * sizeof(float));
+        state.counters["PeakSamplesPerPcm"] = static_cast<double>(peakBytes) / pcmBytes;
+        state.counters["LargestRead"] = static_cast<double>(source.m_payload.size());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(pcmBytes));
+    }
+#endif
+}
@@ -3,7 +3,10 @@ set(FILES
     Include/Sune/SuneBus.h
     Include/Sune/AudioBusManagerInterface.h
     Include/Sune/AudioPlayerBus.h
+    Include/Sune/SampleBuffer.h
     Include/Sune/SoundAsset.h
+    Include/Sune/SoundBankAsset.h
+    Include/Sune/WaveformPeaks.h
     Include/Sune/PlayerAudioEffect.h
     Include/Sune/Utils.h
     Include/Sune/Effects/VisualizerBus.h
@@ -5,6 +5,14 @@ set(FILES
     Source/Tools/SuneEditorSystemComponent.h
     Source/Tools/SoundAssetBuilder.cpp
     Source/Tools/SoundAssetBuilder.h
+    Source/Tools/DecodedSourceCache.cpp
+    Source/Tools/DecodedSourceCache.h
+    Source/Tools/LoudnessMeter.cpp
+    Source/Tools/LoudnessMeter.h
+    Source/Tools/SoundBankBuilder.cpp
+    Source/Tools/SoundBankBuilder.h
+    Source/Tools/WaveformPeaksBuilder.cpp
+    Source/Tools/WaveformPeaksBuilder.h
     Source/Tools/Components/EditorAudioPlayerComponent.cpp
     Source/Tools/Components/EditorAudioPlayerComponent.h
     Source/BuilderSettings/SoundBuilderSettings.h
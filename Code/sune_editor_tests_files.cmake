@@ -1,4 +1,11 @@
 
 set(FILES
     Tests/Tools/SuneEditorTest.cpp
+    Tests/Tools/SoundBuilderTestFixture.h
+    Tests/Tools/VorbisLoadTest.cpp
+    Tests/Tools/VorbisEncodeTest.cpp
+    Tests/Tools/SoundProductTest.cpp
+    Tests/Tools/OpusRoundTripTest.cpp
+    Tests/Tools/AdpcmTest.cpp
+    Tests/Tools/DecodedSourceCacheTest.cpp
 )
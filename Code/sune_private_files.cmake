@@ -11,8 +11,52 @@ set(FILES
     Source/Clients/SoundAsset.cpp
     Source/Clients/SoundAssetHandler.cpp
     Source/Clients/SoundAssetHandler.h
+    Source/Clients/SoundBankAsset.cpp
+    Source/Clients/SoundBankAssetHandler.cpp
+    Source/Clients/SoundBankAssetHandler.h
+    Source/Clients/DecodeCache.cpp
+    Source/Clients/DecodeCache.h
+    Source/Clients/MappedFile.h
+    Source/Clients/Adpcm.cpp
+    Source/Clients/Adpcm.h
+    Source/Clients/Resampler.cpp
+    Source/Clients/Resampler.h
+    Source/Clients/SampleAllocator.cpp
+    Source/Clients/SampleAllocator.h
+    Source/Clients/SampleConversion.cpp
+    Source/Clients/SampleConversion.h
+    Source/Clients/SampleGraveyard.cpp
+    Source/Clients/SampleGraveyard.h
+    Source/Clients/SharedSampleRegistry.cpp
+    Source/Clients/SharedSampleRegistry.h
+    Source/Clients/SoundLoadScheduler.cpp
+    Source/Clients/SoundLoadScheduler.h
+    Source/Clients/SoundMemoryManager.cpp
+    Source/Clients/SoundMemoryManager.h
+    Source/Clients/WaveformPeaks.cpp
     Source/Utils.cpp
 
+    Source/Clients/Decoders/OpusPacketDecoder.cpp
+    Source/Clients/Decoders/OpusPacketDecoder.h
+    Source/Clients/Decoders/SoundDecoder.cpp
+    Source/Clients/Decoders/SoundDecoder.h
+    Source/Clients/Decoders/VorbisDecoder.cpp
+    Source/Clients/Decoders/VorbisDecoder.h
+    Source/Clients/Playback/CompactSoundSource.cpp
+    Source/Clients/Playback/CompactSoundSource.h
+    Source/Clients/Playback/RenderEpochNode.cpp
+    Source/Clients/Playback/RenderEpochNode.h
+    Source/Clients/Playback/ResamplingSoundSource.cpp
+    Source/Clients/Playback/ResamplingSoundSource.h
+    Source/Clients/Playback/SoundSource.cpp
+    Source/Clients/Playback/SoundSource.h
+    Source/Clients/Playback/SoundSourceNode.cpp
+    Source/Clients/Playback/SoundSourceNode.h
+    Source/Clients/Playback/SoundStreamer.cpp
+    Source/Clients/Playback/SoundStreamer.h
+    Source/Clients/Playback/StreamingSoundSource.cpp
+    Source/Clients/Playback/StreamingSoundSource.h
+
     Source/Clients/Effects/LabHrtfEffect.cpp
     Source/Clients/Effects/LabHrtfEffect.h
     Source/Clients/Effects/RadioEffect.cpp
@@ -1,4 +1,9 @@
 
 set(FILES
     Tests/Clients/SuneTest.cpp
+    Tests/Clients/SampleConversionTest.cpp
+    Tests/Clients/ResamplerTest.cpp
+    Tests/Clients/SoundFileTestFixture.h
+    Tests/Clients/DecodeCacheTest.cpp
+    Tests/Clients/SampleAllocatorTest.cpp
 )